@@ -0,0 +1,66 @@
+#include "src/SLib.h"
+
+///
+/// Append throughput per capacity policy.
+/// ARRAY_CAPACITY_EXACT matches the previous behaviour
+/// (resizing the memory on every single append).
+///
+
+template <typename T>
+instant double
+Benchmark_ArrayAdd(
+	ARRAY_CAPACITY_TYPE type,
+	u64 count,
+	T element
+) {
+	Timer timer;
+	Time_Measure(timer, true);
+
+	Array<T> a_data;
+	Array_SetCapacityPolicy(a_data, type);
+
+	FOR(count, it) {
+		Array_Add(a_data, element);
+	}
+
+	double result = Time_Measure(timer, true);
+
+	Array_DestroyContainer(a_data);
+
+	return result;
+}
+
+instant void
+Benchmark_Print(
+	const char *c_name,
+	u64 count,
+	double time_in_ms
+) {
+	std::cout
+		<< c_name << "\t"
+		<< count << " elements\t"
+		<< time_in_ms << " ms\t"
+		<< (u64)(count / (time_in_ms / 1000.0)) << " adds/s"
+		<< std::endl;
+}
+
+int main() {
+	u64 a_counts[] = {1000, 100000, 1000000};
+
+	FOR(ARRAY_COUNT(a_counts), it) {
+		u64 count = a_counts[it];
+
+		Benchmark_Print("Array<u64>    exact    ", count, Benchmark_ArrayAdd(ARRAY_CAPACITY_EXACT    , count, (u64)it));
+		Benchmark_Print("Array<u64>    geometric", count, Benchmark_ArrayAdd(ARRAY_CAPACITY_GEOMETRIC, count, (u64)it));
+		Benchmark_Print("Array<u64>    chunk    ", count, Benchmark_ArrayAdd(ARRAY_CAPACITY_CHUNK    , count, (u64)it));
+
+		/// reference only, so the string allocation is not measured
+		String s_data = S("benchmark");
+
+		Benchmark_Print("Array<String> exact    ", count, Benchmark_ArrayAdd(ARRAY_CAPACITY_EXACT    , count, s_data));
+		Benchmark_Print("Array<String> geometric", count, Benchmark_ArrayAdd(ARRAY_CAPACITY_GEOMETRIC, count, s_data));
+		Benchmark_Print("Array<String> chunk    ", count, Benchmark_ArrayAdd(ARRAY_CAPACITY_CHUNK    , count, s_data));
+	}
+
+	return 0;
+}
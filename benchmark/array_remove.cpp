@@ -0,0 +1,102 @@
+#include "src/SLib.h"
+
+///
+/// Removing entries from arrays with 1M elements.
+///
+
+instant void
+Benchmark_Fill(
+	Array<u64> &a_data,
+	u64 count
+) {
+	Array_ClearContainer(a_data);
+	Array_Reserve(a_data, count);
+
+	FOR(count, it) {
+		Array_Add(a_data, it);
+	}
+}
+
+instant void
+Benchmark_Print(
+	const char *c_name,
+	double time_in_ms
+) {
+	std::cout << c_name << "\t" << time_in_ms << " ms" << std::endl;
+}
+
+int main() {
+	constexpr u64 count = 1000000;
+
+	Array<u64> a_data;
+
+	Timer timer;
+
+	{
+		Benchmark_Fill(a_data, count);
+		Time_Measure(timer, true);
+
+		Array_Filter(a_data, [](u64 value) {
+			return (value % 2 != 0);
+		});
+
+		Benchmark_Print("Array_Filter          (keep every 2nd)  ", Time_Measure(timer, true));
+		Assert(a_data.count == count / 2);
+	}
+
+	{
+		/// the previous filter implementation
+		/// (Array_Remove per entry) for comparison
+		constexpr u64 count_reference = 20000;
+
+		Benchmark_Fill(a_data, count_reference);
+		Time_Measure(timer, true);
+
+		FOR_ARRAY(a_data, it) {
+			if (ARRAY_IT(a_data, it) % 2 == 0) {
+				Array_Remove(a_data, it);
+				--it;
+			}
+		}
+
+		Benchmark_Print("Array_Remove per entry (keep every 2nd, 20k elements only)", Time_Measure(timer, true));
+		Assert(a_data.count == count_reference / 2);
+	}
+
+	{
+		Benchmark_Fill(a_data, count);
+		Time_Measure(timer, true);
+
+		FOR(1000, it) {
+			Array_Remove(a_data, 0);
+		}
+
+		Benchmark_Print("Array_Remove          (1000x first)     ", Time_Measure(timer, true));
+	}
+
+	{
+		Benchmark_Fill(a_data, count);
+		Time_Measure(timer, true);
+
+		FOR(count / 2, it) {
+			Array_RemoveSwap(a_data, it);
+		}
+
+		Benchmark_Print("Array_RemoveSwap      (500k)            ", Time_Measure(timer, true));
+		Assert(a_data.count == count / 2);
+	}
+
+	{
+		Benchmark_Fill(a_data, count);
+		Time_Measure(timer, true);
+
+		Array_RemoveRange(a_data, count / 4, count / 2);
+
+		Benchmark_Print("Array_RemoveRange     (middle half)     ", Time_Measure(timer, true));
+		Assert(a_data.count == count / 2);
+	}
+
+	Array_DestroyContainer(a_data);
+
+	return 0;
+}
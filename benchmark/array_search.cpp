@@ -0,0 +1,70 @@
+#include "src/SLib.h"
+
+///
+/// Lookups into a sorted table: linear Array_Find against
+/// the branchless Array_LowerBound and the Eytzinger layout.
+///
+
+instant u64
+Benchmark_Random(
+	u64 &state
+) {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+
+	return state;
+}
+
+int main() {
+	constexpr u64 count_lookups = 1000000;
+
+	Timer timer;
+
+	for(u64 count = 1000; count <= 10000000; count *= 10) {
+		Array<u32> a_table;
+		Array<u32> a_layout;
+
+		FOR(count, it) {
+			Array_Add(a_table, (u32)(it * 3));
+		}
+
+		Array_ToEytzinger(a_table, a_layout);
+
+		u64 state = 88172645463325252ull;
+		u64 found = 0;
+
+		/// the linear search only gets a fraction of the lookups
+		u64 count_linear = MAX(count_lookups * 1000 / count / 100, (u64)1);
+
+		Time_Measure(timer, true);
+
+		FOR(count_linear, it) {
+			found += Array_Find(a_table, (u32)(Benchmark_Random(state) % (count * 3)));
+		}
+
+		double time_linear = Time_Measure(timer, true) * count_lookups / count_linear;
+
+		FOR(count_lookups, it) {
+			found += Array_FindSorted(a_table, (u32)(Benchmark_Random(state) % (count * 3)));
+		}
+
+		double time_binary = Time_Measure(timer, true);
+
+		FOR(count_lookups, it) {
+			found += Array_EytzingerFind(a_layout, (u32)(Benchmark_Random(state) % (count * 3)));
+		}
+
+		double time_eytzinger = Time_Measure(timer, true);
+
+		std::cout << count << "\t(found " << found << ")" << std::endl;
+		std::cout << "    Array_Find (linear, projected) \t" << time_linear    << " ms" << std::endl;
+		std::cout << "    Array_FindSorted               \t" << time_binary    << " ms" << std::endl;
+		std::cout << "    Array_EytzingerFind            \t" << time_eytzinger << " ms" << std::endl;
+
+		Array_DestroyContainer(a_table);
+		Array_DestroyContainer(a_layout);
+	}
+
+	return 0;
+}
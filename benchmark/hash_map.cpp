@@ -0,0 +1,110 @@
+#include "src/SLib.h"
+
+///
+/// Inserting and looking up keys in HashMap and with linear search.
+///
+
+instant void
+Benchmark_Print(
+	const char *c_name,
+	u64 count,
+	double time_in_ms
+) {
+	std::cout << c_name << "\t" << count << "\t" << time_in_ms << " ms" << std::endl;
+}
+
+int main() {
+	Timer timer;
+
+	for(u64 count = 1000; count <= 1000000; count *= 10) {
+		HashMap<u64, u64> map;
+
+		Time_Measure(timer, true);
+
+		FOR(count, it) {
+			HashMap_Set(map, it * 7919, it);
+		}
+
+		Benchmark_Print("HashMap_Set          ", count, Time_Measure(timer, true));
+
+		u64 found = 0;
+
+		FOR(count, it) {
+			found += (HashMap_Find(map, it * 7919) != nullptr);
+		}
+
+		Benchmark_Print("HashMap_Find         ", count, Time_Measure(timer, true));
+		Assert(found == count);
+
+		FOR(count, it) {
+			HashMap_Remove(map, it * 7919);
+		}
+
+		Benchmark_Print("HashMap_Remove       ", count, Time_Measure(timer, true));
+		Assert(map.count == 0);
+
+		HashMap_Destroy(map);
+	}
+
+	/// linear scan (same as Map), so it stays with fewer keys
+	for(u64 count = 1000; count <= 10000; count *= 10) {
+		Array<u64> a_keys;
+
+		Time_Measure(timer, true);
+
+		FOR(count, it) {
+			Array_AddUnique(a_keys, it * 7919);
+		}
+
+		Benchmark_Print("Array_AddUnique      ", count, Time_Measure(timer, true));
+
+		u64 found = 0;
+
+		FOR(count, it) {
+			found += Array_Find(a_keys, it * 7919);
+		}
+
+		Benchmark_Print("Array_Find           ", count, Time_Measure(timer, true));
+		Assert(found == count);
+
+		Array_DestroyContainer(a_keys);
+	}
+
+	{
+		/// string keys, stored by reference
+		constexpr u64 count = 100000;
+
+		Array<String> a_keys;
+		Array_Reserve(a_keys, count);
+
+		FOR(count, it) {
+			String s_key = Convert_IntToString(it * 7919);
+			String_Insert(s_key, S("key_"), 0);
+			Array_Add(a_keys, s_key);
+		}
+
+		HashMap<String, u64> map;
+
+		Time_Measure(timer, true);
+
+		FOR(count, it) {
+			HashMap_Set(map, ARRAY_IT(a_keys, it), it);
+		}
+
+		Benchmark_Print("HashMap_Set  (String)", count, Time_Measure(timer, true));
+
+		u64 found = 0;
+
+		FOR(count, it) {
+			found += (HashMap_Find(map, ARRAY_IT(a_keys, it)) != nullptr);
+		}
+
+		Benchmark_Print("HashMap_Find (String)", count, Time_Measure(timer, true));
+		Assert(found == count);
+
+		HashMap_Destroy(map);
+		Array_Destroy(a_keys);
+	}
+
+	return 0;
+}
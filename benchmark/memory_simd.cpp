@@ -0,0 +1,90 @@
+#include "src/SLib.h"
+
+///
+/// Throughput of Memory_Copy / Memory_Set / Memory_Compare
+/// per implementation (scalar, SSE2, AVX2).
+///
+
+instant const char *
+Benchmark_GetName(
+	MEMORY_SIMD_TYPE type
+) {
+	switch (type) {
+		case MEMORY_SIMD_SSE2: return "SSE2  ";
+		case MEMORY_SIMD_AVX2: return "AVX2  ";
+		default:               return "Scalar";
+	}
+}
+
+instant void
+Benchmark_Print(
+	const char *c_name,
+	MEMORY_SIMD_TYPE type,
+	u64 size,
+	u64 repeat,
+	double time_in_ms
+) {
+	double bytes = (double)size * repeat;
+
+	std::cout
+		<< c_name << "\t"
+		<< Benchmark_GetName(type) << "\t"
+		<< size << " B\t"
+		<< (bytes / (time_in_ms / 1000.0)) / Gigabyte(1) << " GB/s"
+		<< std::endl;
+}
+
+int main() {
+	MEMORY_SIMD_TYPE simd_available = memory_simd;
+
+	constexpr u64 size_max = 64 * 1024 * 1024;
+
+	char *c_source = Memory_Create(char, size_max);
+	char *c_dest   = Memory_Create(char, size_max);
+
+	for(u64 size = 8; size <= size_max; size *= 2) {
+		/// move roughly the same amount of bytes for every size
+		u64 repeat = MAX((size_max * 2) / size, 1);
+
+		FOR((u64)simd_available + 1, it_type) {
+			memory_simd = (MEMORY_SIMD_TYPE)it_type;
+
+			Timer timer;
+			Time_Measure(timer, true);
+
+			FOR(repeat, it)
+				Memory_Copy(c_dest, c_source, size);
+
+			Benchmark_Print("Memory_Copy   ", memory_simd, size, repeat, Time_Measure(timer, true));
+
+			FOR(repeat, it)
+				Memory_Set(c_dest, (int)it, size);
+
+			Benchmark_Print("Memory_Set    ", memory_simd, size, repeat, Time_Measure(timer, true));
+
+			/// equal content, so the whole range has to be compared
+			Memory_Copy(c_source, c_dest, size);
+			Time_Measure(timer, true);
+
+			u64 equal_count = 0;
+
+			FOR(repeat, it) {
+				equal_count += Memory_Compare(c_dest, c_source, size);
+
+				/// prevent moving the comparison out of the loop
+				asm volatile("" ::: "memory");
+			}
+
+			Benchmark_Print("Memory_Compare", memory_simd, size, repeat, Time_Measure(timer, true));
+
+			Assert(equal_count == repeat);
+		}
+	}
+
+	memory_simd = simd_available;
+
+	Memory_Free(c_source);
+	Memory_Free(c_dest);
+
+	return 0;
+}
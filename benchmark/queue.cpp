@@ -0,0 +1,260 @@
+#include "src/SLib.h"
+
+///
+/// Queue_SPSC and Queue_MPMC throughput (single and batched) from
+/// 2 to 16 threads, plus the round trip latency between two threads.
+///
+/// Waiting threads yield with Sleep(0), so the numbers stay
+/// meaningful with more threads than cores.
+///
+
+#define BENCHMARK_BATCH 64
+
+struct Benchmark_Data {
+	Queue_SPSC<u64> *queue_spsc  = nullptr;
+	Queue_SPSC<u64> *queue_reply = nullptr;
+	Queue_MPMC<u64> *queue_mpmc  = nullptr;
+
+	u64  count    = 0;
+	u64  sum      = 0;
+	bool is_batch = false;
+};
+
+template <typename Q>
+instant void
+Benchmark_Produce(
+	Q &queue,
+	u64 count,
+	bool is_batch
+) {
+	u64 values[BENCHMARK_BATCH];
+	u64 index = 0;
+
+	while(index < count) {
+		u64 count_batch = (is_batch) ? MIN((u64)BENCHMARK_BATCH, count - index) : 1;
+
+		FOR(count_batch, it) {
+			values[it] = index + it + 1;
+		}
+
+		u64 count_pushed = Queue_PushBatch(queue, values, count_batch);
+
+		if (!count_pushed)
+			Sleep(0);
+
+		index += count_pushed;
+	}
+}
+
+template <typename Q>
+instant u64
+Benchmark_Consume(
+	Q &queue,
+	u64 count,
+	bool is_batch
+) {
+	u64 values[BENCHMARK_BATCH];
+	u64 sum = 0;
+	u64 index = 0;
+
+	while(index < count) {
+		/// not more than its share, the other consumers wait for the rest
+		u64 count_batch  = (is_batch) ? MIN((u64)BENCHMARK_BATCH, count - index) : 1;
+		u64 count_popped = Queue_PopBatch(queue, values, count_batch);
+
+		if (!count_popped)
+			Sleep(0);
+
+		FOR(count_popped, it) {
+			sum += values[it];
+		}
+
+		index += count_popped;
+	}
+
+	return sum;
+}
+
+instant ulong WINAPI
+Benchmark_ProducerSPSC(
+	void *data
+) {
+	Benchmark_Data &bench = *(Benchmark_Data *)data;
+	Benchmark_Produce(*bench.queue_spsc, bench.count, bench.is_batch);
+
+	return 0;
+}
+
+instant ulong WINAPI
+Benchmark_ProducerMPMC(
+	void *data
+) {
+	Benchmark_Data &bench = *(Benchmark_Data *)data;
+	Benchmark_Produce(*bench.queue_mpmc, bench.count, bench.is_batch);
+
+	return 0;
+}
+
+instant ulong WINAPI
+Benchmark_ConsumerMPMC(
+	void *data
+) {
+	Benchmark_Data &bench = *(Benchmark_Data *)data;
+	bench.sum = Benchmark_Consume(*bench.queue_mpmc, bench.count, bench.is_batch);
+
+	return 0;
+}
+
+/// sends every value it receives back
+instant ulong WINAPI
+Benchmark_Echo(
+	void *data
+) {
+	Benchmark_Data &bench = *(Benchmark_Data *)data;
+
+	FOR(bench.count, it) {
+		u64 value;
+
+		while(!Queue_Pop(*bench.queue_spsc, &value))
+			Sleep(0);
+
+		while(!Queue_Push(*bench.queue_reply, value))
+			Sleep(0);
+	}
+
+	return 0;
+}
+
+instant void
+Benchmark_Print(
+	const char *c_name,
+	u64 count_threads,
+	u64 count,
+	double time_in_ms
+) {
+	std::cout
+		<< c_name << "\t"
+		<< count_threads << " threads\t"
+		<< time_in_ms << " ms\t"
+		<< (u64)(count / (time_in_ms / 1000.0)) << " elements/s"
+		<< std::endl;
+}
+
+int main() {
+	constexpr u64 count = 10000000;
+
+	Timer timer;
+
+	FOR(2, is_batch) {
+		Queue_SPSC<u64> queue;
+		Queue_Create(queue, 4096);
+
+		Benchmark_Data bench;
+		bench.queue_spsc = &queue;
+		bench.count      = count;
+		bench.is_batch   = is_batch;
+
+		Time_Measure(timer, true);
+
+		Thread thread = Thread_Create(&bench, Benchmark_ProducerSPSC);
+		Thread_Execute(&thread);
+
+		u64 sum = Benchmark_Consume(queue, count, is_batch);
+
+		Thread_WaitFor(&thread);
+		Thread_Destroy(&thread);
+
+		double time_in_ms = Time_Measure(timer, true);
+		Assert(sum == count * (count + 1) / 2);
+
+		Benchmark_Print((is_batch) ? "Queue_SPSC batch " : "Queue_SPSC single", 2, count, time_in_ms);
+
+		Queue_Destroy(queue);
+	}
+
+	/// half of the threads produce, the other half consumes
+	for(u64 count_threads = 2; count_threads <= 16; count_threads *= 2) {
+		FOR(2, is_batch) {
+			Queue_MPMC<u64> queue;
+			Queue_Create(queue, 4096);
+
+			u64 count_pairs    = count_threads / 2;
+			u64 count_per_pair = count / count_pairs;
+
+			Benchmark_Data benches[16];
+			Thread threads[16];
+
+			Time_Measure(timer, true);
+
+			FOR(count_threads, it) {
+				Benchmark_Data &bench = benches[it];
+				bench = {};
+				bench.queue_mpmc = &queue;
+				bench.count      = count_per_pair;
+				bench.is_batch   = is_batch;
+
+				threads[it] = Thread_Create(&bench, (it < count_pairs) ? Benchmark_ProducerMPMC : Benchmark_ConsumerMPMC);
+				Thread_Execute(&threads[it]);
+			}
+
+			u64 sum = 0;
+
+			FOR(count_threads, it) {
+				Thread_WaitFor(&threads[it]);
+				Thread_Destroy(&threads[it]);
+
+				sum += benches[it].sum;
+			}
+
+			double time_in_ms = Time_Measure(timer, true);
+			Assert(sum == count_pairs * (count_per_pair * (count_per_pair + 1) / 2));
+
+			Benchmark_Print((is_batch) ? "Queue_MPMC batch " : "Queue_MPMC single", count_threads, count_pairs * count_per_pair, time_in_ms);
+
+			Queue_Destroy(queue);
+		}
+	}
+
+	{
+		constexpr u64 count_round_trips = 100000;
+
+		Queue_SPSC<u64> queue_request;
+		Queue_SPSC<u64> queue_reply;
+		Queue_Create(queue_request, 16);
+		Queue_Create(queue_reply, 16);
+
+		Benchmark_Data bench;
+		bench.queue_spsc  = &queue_request;
+		bench.queue_reply = &queue_reply;
+		bench.count       = count_round_trips;
+
+		Thread thread = Thread_Create(&bench, Benchmark_Echo);
+		Thread_Execute(&thread);
+
+		Time_Measure(timer, true);
+
+		FOR(count_round_trips, it) {
+			u64 value;
+
+			while(!Queue_Push(queue_request, it))
+				Sleep(0);
+
+			while(!Queue_Pop(queue_reply, &value))
+				Sleep(0);
+
+			Assert(value == it);
+		}
+
+		double time_in_ms = Time_Measure(timer, true);
+
+		Thread_WaitFor(&thread);
+		Thread_Destroy(&thread);
+
+		std::cout << "Queue_SPSC round trip\t" << (time_in_ms * 1000000.0 / count_round_trips) << " ns" << std::endl;
+
+		Queue_Destroy(queue_request);
+		Queue_Destroy(queue_reply);
+	}
+
+	return 0;
+}
@@ -0,0 +1,122 @@
+#include "src/SLib.h"
+
+///
+/// Array_SortParallel with 1 to 16 threads on 10M u64 and 1M String.
+///
+
+instant u64
+Benchmark_Random(
+	u64 &state
+) {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+
+	return state;
+}
+
+instant void
+Benchmark_Fill(
+	Array<u64> &a_data,
+	u64 count
+) {
+	Array_ClearContainer(a_data);
+	Array_Reserve(a_data, count);
+
+	u64 state = 88172645463325252ull;
+
+	FOR(count, it) {
+		Array_Add(a_data, Benchmark_Random(state));
+	}
+}
+
+/// strings point into s_buffer, so refilling only resets the array
+instant void
+Benchmark_Fill(
+	Array<String> &as_data,
+	String &s_buffer,
+	u64 count
+) {
+	Array_ClearContainer(as_data);
+	Array_Reserve(as_data, count);
+
+	constexpr u64 length = 16;
+
+	if (!s_buffer.length) {
+		u64 state = 88172645463325252ull;
+
+		FOR(count * length, it) {
+			String_Append(s_buffer, S("abcdefghijklmnopqrstuvwxyz" + (Benchmark_Random(state) % 26), 1));
+		}
+	}
+
+	FOR(count, it) {
+		Array_Add(as_data, S(s_buffer.value + it * length, length));
+	}
+}
+
+int main() {
+	constexpr u64 threads[] = {1, 2, 4, 8, 16};
+
+	Timer timer;
+
+	{
+		constexpr u64 count = 10000000;
+
+		Array<u64> a_data;
+		double time_single = 0.0;
+
+		for(u64 count_threads : threads) {
+			Benchmark_Fill(a_data, count);
+			Time_Measure(timer, true);
+
+			Array_SortParallel(a_data, SORT_ORDER_ASCENDING, count_threads);
+
+			double time_in_ms = Time_Measure(timer, true);
+
+			if (count_threads == 1)
+				time_single = time_in_ms;
+
+			FOR_START(1, a_data.count, it) {
+				Assert(ARRAY_IT(a_data, it - 1) <= ARRAY_IT(a_data, it));
+			}
+
+			std::cout << "Array_SortParallel u64   \t" << count << "\t" << count_threads << " threads\t"
+					  << time_in_ms << " ms\t" << (time_single / time_in_ms) << "x" << std::endl;
+		}
+
+		Array_DestroyContainer(a_data);
+	}
+
+	{
+		constexpr u64 count = 1000000;
+
+		Array<String> as_data;
+		String s_buffer;
+		double time_single = 0.0;
+
+		for(u64 count_threads : threads) {
+			Benchmark_Fill(as_data, s_buffer, count);
+			Time_Measure(timer, true);
+
+			Array_SortParallel(as_data, SORT_ORDER_ASCENDING, count_threads);
+
+			double time_in_ms = Time_Measure(timer, true);
+
+			if (count_threads == 1)
+				time_single = time_in_ms;
+
+			FOR_START(1, as_data.count, it) {
+				Assert(ARRAY_IT(as_data, it - 1) <= ARRAY_IT(as_data, it));
+			}
+
+			std::cout << "Array_SortParallel String\t" << count << "\t" << count_threads << " threads\t"
+					  << time_in_ms << " ms\t" << (time_single / time_in_ms) << "x" << std::endl;
+		}
+
+		Array_DestroyContainer(as_data);
+		String_Destroy(s_buffer);
+	}
+
+	return 0;
+}
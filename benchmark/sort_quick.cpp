@@ -1,43 +1,146 @@
 #include "src/SLib.h"
-#include "test/core.h"
 
 ///
-/// @Note: set DEBUG_BENCHMARK to 1
-///        in SLib.h to see measuring output
+/// Array_Sort with different input distributions from 10k to 10M elements.
 ///
 
+enum BENCHMARK_DISTRIBUTION {
+	BENCHMARK_RANDOM,
+	BENCHMARK_SORTED,
+	BENCHMARK_REVERSED,
+	BENCHMARK_DUPLICATES,
+	BENCHMARK_SAWTOOTH,
+	BENCHMARK_ORGAN_PIPE,
+	BENCHMARK_DISTRIBUTION_COUNT
+};
+
+static const char *benchmark_distribution_names[] = {
+	"random    ",
+	"sorted    ",
+	"reversed  ",
+	"duplicates",
+	"sawtooth  ",
+	"organ pipe"
+};
+
+instant u64
+Benchmark_Random(
+	u64 &state
+) {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+
+	return state;
+}
+
+instant void
+Benchmark_Fill(
+	Array<u64> &a_data,
+	u64 count,
+	BENCHMARK_DISTRIBUTION type
+) {
+	Array_ClearContainer(a_data);
+	Array_Reserve(a_data, count);
+
+	u64 state = 88172645463325252ull;
+
+	FOR(count, it) {
+		u64 value = 0;
+
+		switch (type) {
+			case BENCHMARK_RANDOM:     { value = Benchmark_Random(state);      } break;
+			case BENCHMARK_SORTED:     { value = it;                           } break;
+			case BENCHMARK_REVERSED:   { value = count - it;                   } break;
+			case BENCHMARK_DUPLICATES: { value = Benchmark_Random(state) % 16; } break;
+			case BENCHMARK_SAWTOOTH:   { value = it % 1000;                    } break;
+			case BENCHMARK_ORGAN_PIPE: { value = (it < count / 2) ? it : count - it; } break;
+			default: {
+				Assert(false);
+			} break;
+		}
+
+		Array_Add(a_data, value);
+	}
+}
+
 int main() {
-	Array<u64> a_test;
+	Array<u64> a_data;
+
+	Timer timer;
 
-	FOR(10000, it) {
-		Array_Add(&a_test, (u64)rand());
+	for(u64 count = 10000; count <= 10000000; count *= 10) {
+		FOR(BENCHMARK_DISTRIBUTION_COUNT, type) {
+			Benchmark_Fill(a_data, count, (BENCHMARK_DISTRIBUTION)type);
+			Time_Measure(timer, true);
+
+			Array_Sort(&a_data, SORT_ORDER_ASCENDING);
+
+			double time_in_ms = Time_Measure(timer, true);
+
+			FOR_START(1, a_data.count, it) {
+				Assert(ARRAY_IT(a_data, it - 1) <= ARRAY_IT(a_data, it));
+			}
+
+			std::cout << "Array_Sort " << benchmark_distribution_names[type] << "\t"
+					  << count << "\t" << time_in_ms << " ms" << std::endl;
+		}
 	}
 
-	MEASURE_START();
+	{
+		/// function pointer comparator (indirect call per comparison)
+		/// against an inlined lambda on the same input
+		constexpr u64 count = 1000000;
 
-	Array_Sort_Descending(&a_test);
-	MEASURE_END("Sort-Descending\t\t\t");
+		Benchmark_Fill(a_data, count, BENCHMARK_RANDOM);
+		Time_Measure(timer, true);
 
-	Array_Sort_Descending(&a_test);
-	MEASURE_END("Sort-Descending again\t\t");
+		Array_Sort(&a_data, Sort_OnCompareAscending);
+		double time_pointer = Time_Measure(timer, true);
 
-	Array_Sort_Ascending(&a_test);
-	MEASURE_END("Sort-Ascending\t\t\t");
+		Benchmark_Fill(a_data, count, BENCHMARK_RANDOM);
+		Time_Measure(timer, true);
+
+		Array_Sort(a_data, [](u64 one, u64 two) { return (one < two); });
+		double time_functor = Time_Measure(timer, true);
+
+		std::cout << "Array_Sort function pointer\t" << count << "\t" << time_pointer << " ms" << std::endl;
+		std::cout << "Array_Sort functor         \t" << count << "\t" << time_functor << " ms" << std::endl;
+		std::cout << "speedup                    \t" << (time_pointer / time_functor) << "x" << std::endl;
+	}
 
-	Array_Sort_Ascending(&a_test);
-	MEASURE_END("Sort-Ascending  again\t\t");
+	{
+		/// re-sorting a sorted list after a single insert,
+		/// which the stable sort merges in O(n)
+		constexpr u64 count = 1000000;
 
-	Array_Sort(&a_test, Sort_OnCompareDescending);
-	MEASURE_END("Sort-Descending (custom)\t");
+		Benchmark_Fill(a_data, count, BENCHMARK_SORTED);
+		Array_Add(a_data, count / 3);
+		Time_Measure(timer, true);
 
-	Array_Sort(&a_test, Sort_OnCompareDescending);
-	MEASURE_END("Sort-Descending (custom again)\t");
+		Array_Sort(a_data, SORT_ORDER_ASCENDING);
+		double time_unstable = Time_Measure(timer, true);
 
-	Array_Sort(&a_test, Sort_OnCompareAscending);
-	MEASURE_END("Sort-Ascending  (custom)\t");
+		Benchmark_Fill(a_data, count, BENCHMARK_SORTED);
+		Array_Add(a_data, count / 3);
+		Time_Measure(timer, true);
+
+		Array_SortStable(a_data, SORT_ORDER_ASCENDING);
+		double time_stable = Time_Measure(timer, true);
+
+		std::cout << "Array_Sort       sorted + 1\t" << count << "\t" << time_unstable << " ms" << std::endl;
+		std::cout << "Array_SortStable sorted + 1\t" << count << "\t" << time_stable   << " ms" << std::endl;
+
+		Benchmark_Fill(a_data, count, BENCHMARK_RANDOM);
+		Time_Measure(timer, true);
+
+		Array_SortStable(a_data, SORT_ORDER_ASCENDING);
+		double time_random = Time_Measure(timer, true);
+
+		std::cout << "Array_SortStable random    \t" << count << "\t" << time_random << " ms" << std::endl;
+	}
 
-	Array_Sort(&a_test, Sort_OnCompareAscending);
-	MEASURE_END("Sort-Ascending  (custom again)\t");
+	Array_DestroyContainer(a_data);
 
 	return 0;
 }
@@ -0,0 +1,122 @@
+#include "src/SLib.h"
+
+///
+/// Array_SortRadix (8/11/16 bit digits) against Array_Sort.
+///
+
+struct Benchmark_Row {
+	u64   id;
+	float timestamp;
+};
+
+instant u64
+Benchmark_Random(
+	u64 &state
+) {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+
+	return state;
+}
+
+template <typename T, typename Func>
+instant void
+Benchmark_Fill(
+	Array<T> &a_data,
+	u64 count,
+	Func OnValue
+) {
+	Array_ClearContainer(a_data);
+	Array_Reserve(a_data, count);
+
+	u64 state = 88172645463325252ull;
+
+	FOR(count, it) {
+		Array_Add(a_data, OnValue(Benchmark_Random(state)));
+	}
+}
+
+instant void
+Benchmark_Print(
+	const char *c_name,
+	u64 count,
+	double time_in_ms
+) {
+	std::cout << c_name << "\t" << count << "\t" << time_in_ms << " ms" << std::endl;
+}
+
+int main() {
+	Timer timer;
+
+	Array<u64> a_u64;
+	Array<u32> a_u32;
+	Array<float> a_float;
+	Array<Benchmark_Row> a_rows;
+
+	auto OnU64   = [](u64 value) { return value; };
+	auto OnU32   = [](u64 value) { return (u32)value; };
+	auto OnFloat = [](u64 value) { return (float)((s64)value % 1000000) / 7.0f; };
+	auto OnRow   = [](u64 value) { return Benchmark_Row{value, (float)(value % 100000)}; };
+
+	for(u64 count = 1000000; count <= 10000000; count *= 10) {
+		Benchmark_Fill(a_u64, count, OnU64);
+		Time_Measure(timer, true);
+		Array_Sort(a_u64, SORT_ORDER_ASCENDING);
+		Benchmark_Print("Array_Sort         u64  ", count, Time_Measure(timer, true));
+
+		Benchmark_Fill(a_u64, count, OnU64);
+		Time_Measure(timer, true);
+		Array_SortRadix(a_u64, SORT_RADIX_8);
+		Benchmark_Print("Array_SortRadix  8 u64  ", count, Time_Measure(timer, true));
+
+		Benchmark_Fill(a_u64, count, OnU64);
+		Time_Measure(timer, true);
+		Array_SortRadix(a_u64, SORT_RADIX_11);
+		Benchmark_Print("Array_SortRadix 11 u64  ", count, Time_Measure(timer, true));
+
+		Benchmark_Fill(a_u64, count, OnU64);
+		Time_Measure(timer, true);
+		Array_SortRadix(a_u64, SORT_RADIX_16);
+		Benchmark_Print("Array_SortRadix 16 u64  ", count, Time_Measure(timer, true));
+
+		Benchmark_Fill(a_u32, count, OnU32);
+		Time_Measure(timer, true);
+		Array_Sort(a_u32, SORT_ORDER_ASCENDING);
+		Benchmark_Print("Array_Sort         u32  ", count, Time_Measure(timer, true));
+
+		Benchmark_Fill(a_u32, count, OnU32);
+		Time_Measure(timer, true);
+		Array_SortRadix(a_u32, SORT_RADIX_11);
+		Benchmark_Print("Array_SortRadix 11 u32  ", count, Time_Measure(timer, true));
+
+		Benchmark_Fill(a_float, count, OnFloat);
+		Time_Measure(timer, true);
+		Array_Sort(a_float, SORT_ORDER_ASCENDING);
+		Benchmark_Print("Array_Sort         float", count, Time_Measure(timer, true));
+
+		Benchmark_Fill(a_float, count, OnFloat);
+		Time_Measure(timer, true);
+		Array_SortRadix(a_float, SORT_RADIX_11);
+		Benchmark_Print("Array_SortRadix 11 float", count, Time_Measure(timer, true));
+
+		Benchmark_Fill(a_rows, count, OnRow);
+		Time_Measure(timer, true);
+		Array_Sort(a_rows, [](Benchmark_Row &one, Benchmark_Row &two) {
+			return (one.timestamp < two.timestamp);
+		});
+		Benchmark_Print("Array_Sort         row  ", count, Time_Measure(timer, true));
+
+		Benchmark_Fill(a_rows, count, OnRow);
+		Time_Measure(timer, true);
+		Array_SortRadix(a_rows, [](const Benchmark_Row &row) { return row.timestamp; }, SORT_RADIX_11);
+		Benchmark_Print("Array_SortRadix 11 row  ", count, Time_Measure(timer, true));
+	}
+
+	Array_DestroyContainer(a_u64);
+	Array_DestroyContainer(a_u32);
+	Array_DestroyContainer(a_float);
+	Array_DestroyContainer(a_rows);
+
+	return 0;
+}
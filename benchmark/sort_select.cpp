@@ -0,0 +1,85 @@
+#include "src/SLib.h"
+
+///
+/// Top 100 of 10M elements: full Array_Sort against
+/// Array_PartialSort, Array_TopK and Array_SelectNth.
+///
+
+instant u64
+Benchmark_Random(
+	u64 &state
+) {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+
+	return state;
+}
+
+instant void
+Benchmark_Fill(
+	Array<u64> &a_data,
+	u64 count
+) {
+	Array_ClearContainer(a_data);
+	Array_Reserve(a_data, count);
+
+	u64 state = 88172645463325252ull;
+
+	FOR(count, it) {
+		Array_Add(a_data, Benchmark_Random(state));
+	}
+}
+
+int main() {
+	constexpr u64 count = 10000000;
+	constexpr u64 count_top = 100;
+
+	Array<u64> a_data;
+	Array<u64> a_top;
+
+	Timer timer;
+
+	auto OnCompare = [](u64 one, u64 two) { return (one > two); };
+
+	Benchmark_Fill(a_data, count);
+	Time_Measure(timer, true);
+
+	Array_Sort(a_data, OnCompare);
+
+	double time_sort = Time_Measure(timer, true);
+	u64 value_sort = ARRAY_IT(a_data, count_top - 1);
+
+	Benchmark_Fill(a_data, count);
+	Time_Measure(timer, true);
+
+	Array_PartialSort(a_data, count_top, OnCompare);
+
+	double time_partial = Time_Measure(timer, true);
+	Assert(ARRAY_IT(a_data, count_top - 1) == value_sort);
+
+	Benchmark_Fill(a_data, count);
+	Time_Measure(timer, true);
+
+	Array_TopK(a_data, count_top, a_top, OnCompare);
+
+	double time_top = Time_Measure(timer, true);
+	Assert(ARRAY_IT(a_top, count_top - 1) == value_sort);
+
+	Time_Measure(timer, true);
+
+	Array_SelectNth(a_data, count_top - 1, OnCompare);
+
+	double time_select = Time_Measure(timer, true);
+	Assert(ARRAY_IT(a_data, count_top - 1) == value_sort);
+
+	std::cout << "Array_Sort        \t" << count << "\t" << time_sort    << " ms" << std::endl;
+	std::cout << "Array_PartialSort \t" << count << "\t" << time_partial << " ms" << std::endl;
+	std::cout << "Array_TopK        \t" << count << "\t" << time_top     << " ms" << std::endl;
+	std::cout << "Array_SelectNth   \t" << count << "\t" << time_select  << " ms" << std::endl;
+
+	Array_DestroyContainer(a_data);
+	Array_DestroyContainer(a_top);
+
+	return 0;
+}
@@ -0,0 +1,135 @@
+#include "src/SLib.h"
+
+///
+/// Counting k keywords in a 100 MB log: one String_IndexOf
+/// pass per keyword against a single StringMatcher pass.
+///
+/// Array_FindFirstString on every line of the log: one String_IndexOf
+/// per keyword, a matcher created per call and a prebuilt matcher.
+///
+
+int main() {
+	constexpr u64 size = 100 * 1024 * 1024;
+
+	const char *c_words[] = {
+		"request", "served", "client", "timeout", "connection", "closed",
+		"error", "warning", "retry", "cache", "miss", "hit", "upstream",
+		"latency", "bytes", "session", "expired", "denied", "token", "refresh",
+		"socket", "reset", "queue", "full", "worker", "started", "stopped",
+		"disk", "write", "read", "config", "reload"
+	};
+
+	String s_log;
+	String_Resize(s_log, size);
+
+	/// words taken from the keyword list with random suffixes,
+	/// so most lines contain partial matches
+	u64 state = 88172645463325252ull;
+	u64 length = 0;
+
+	while(length < size) {
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		const char *c_word = c_words[state % ARRAY_COUNT(c_words)];
+		u64 length_word = String_GetLength(c_word);
+
+		if (length + length_word + 2 > size)
+			break;
+
+		Memory_Copy(s_log.value + length, c_word, length_word - (state >> 20) % 2);
+		length += length_word - (state >> 20) % 2;
+
+		s_log.value[length++] = ((state >> 24) % 10) ? ' ' : '\n';
+	}
+
+	s_log.length = length;
+
+	Array<String> as_lines = Array_SplitLinesRef(s_log, false);
+
+	Timer timer;
+
+	for(u64 count_keys = 1; count_keys <= ARRAY_COUNT(c_words); count_keys *= 2) {
+		Array<String> as_keys;
+
+		FOR(count_keys, it) {
+			Array_Add(as_keys, S(c_words[it]));
+		}
+
+		Time_Measure(timer, true);
+
+		u64 count_found_single = 0;
+
+		FOR_ARRAY(as_keys, it) {
+			s64 index = 0;
+
+			while((index = String_IndexOf(s_log, ARRAY_IT(as_keys, it), index, true)) >= 0) {
+				++count_found_single;
+				++index;
+			}
+		}
+
+		double time_single = Time_Measure(timer, true);
+
+		StringMatcher matcher;
+		StringMatcher_Create(matcher, as_keys);
+
+		Array<StringMatcher_Match> a_matches;
+		Array_Reserve(a_matches, count_found_single);
+
+		double time_create = Time_Measure(timer, true);
+
+		u64 count_found_matcher = StringMatcher_FindAll(matcher, s_log, a_matches);
+
+		double time_matcher = Time_Measure(timer, true);
+
+		std::cout << count_keys << " keys\t(found " << count_found_single << " / " << count_found_matcher << ")" << std::endl;
+		std::cout << "    String_IndexOf per key \t" << time_single  << " ms" << std::endl;
+		std::cout << "    StringMatcher_FindAll  \t" << time_matcher << " ms (create: " << time_create << " ms)" << std::endl;
+
+		/// first key per line
+		u64 count_lines_scan    = 0;
+		u64 count_lines_create  = 0;
+		u64 count_lines_matcher = 0;
+
+		Time_Measure(timer, true);
+
+		FOR_ARRAY(as_lines, it) {
+			count_lines_scan += _Array_FindFirstStringScan(ARRAY_IT(as_lines, it), as_keys, 0, 0, 0);
+		}
+
+		double time_lines_scan = Time_Measure(timer, true);
+
+		FOR_ARRAY(as_lines, it) {
+			StringMatcher t_matcher;
+			StringMatcher_Create(t_matcher, as_keys);
+
+			count_lines_create += Array_FindFirstString(&ARRAY_IT(as_lines, it), t_matcher);
+
+			StringMatcher_Destroy(t_matcher);
+		}
+
+		double time_lines_create = Time_Measure(timer, true);
+
+		FOR_ARRAY(as_lines, it) {
+			count_lines_matcher += Array_FindFirstString(&ARRAY_IT(as_lines, it), matcher);
+		}
+
+		double time_lines_matcher = Time_Measure(timer, true);
+
+		std::cout << "    Array_FindFirstString per line (found " << count_lines_scan << " / " << count_lines_create << " / " << count_lines_matcher << ")" << std::endl;
+		std::cout << "        String_IndexOf per key \t" << time_lines_scan    << " ms" << std::endl;
+		std::cout << "        matcher per call      \t" << time_lines_create  << " ms" << std::endl;
+		std::cout << "        prebuilt matcher      \t" << time_lines_matcher << " ms" << std::endl;
+
+		Array_DestroyContainer(a_matches);
+		StringMatcher_Destroy(matcher);
+		Array_DestroyContainer(as_keys);
+	}
+
+	Array_DestroyContainer(as_lines);
+	String_Destroy(s_log);
+
+	return 0;
+}
@@ -0,0 +1,210 @@
+#include "src/SLib.h"
+
+///
+/// Array_Split and CSV_Load with short strings in pool slots
+/// against one heap allocation per string (previous behaviour).
+/// Timings include destroying the results.
+///
+/// @Note the numbers in the commit were measured on Linux with glibc
+///       malloc, which is already cheap for small blocks. The MinGW
+///       target allocates through the Windows CRT heap, which was not
+///       measured, so the speedup there can differ.
+///
+
+/// previous Array_Split (DELIMITER_IGNORE), every element on the heap
+instant void
+Benchmark_SplitHeap(
+	Array<String> &as_buffer_out,
+	const String &s_data,
+	const String &s_delimiter,
+	u64 *count_alloc_io
+) {
+	String s_data_it = S(s_data);
+
+	s64 pos_found;
+	while(String_Find(s_data_it, s_delimiter, &pos_found)) {
+		String s_element;
+		s_element.value  = Memory_Create(char, pos_found);
+		s_element.length = pos_found;
+		Memory_Copy(s_element.value, s_data_it.value, pos_found);
+
+		Array_Add(as_buffer_out, s_element);
+		++(*count_alloc_io);
+
+		String_AddOffset(s_data_it, pos_found + s_delimiter.length);
+	}
+
+	if (!String_IsEmpty(s_data_it)) {
+		String s_element;
+		s_element.value  = Memory_Create(char, s_data_it.length);
+		s_element.length = s_data_it.length;
+		Memory_Copy(s_element.value, s_data_it.value, s_data_it.length);
+
+		Array_Add(as_buffer_out, s_element);
+		++(*count_alloc_io);
+	}
+}
+
+/// heap allocations of the strings: new pool slabs and long strings
+instant u64
+Benchmark_CountPooled(
+	const Array<String> &as_data,
+	u64 count_slabs_before
+) {
+	u64 count_alloc = string_pool.data.count_slabs - count_slabs_before;
+
+	FOR_ARRAY(as_data, it) {
+		if (ARRAY_IT(as_data, it).length > STRING_BUFFER_DEFAULT_SIZE)
+			++count_alloc;
+	}
+
+	return count_alloc;
+}
+
+instant void
+Benchmark_Print(
+	const char *c_name,
+	u64 count_strings,
+	u64 count_alloc,
+	double time_in_ms
+) {
+	std::cout
+		<< c_name << "\t"
+		<< count_strings << " strings\t"
+		<< count_alloc << " string allocations\t"
+		<< time_in_ms << " ms"
+		<< std::endl;
+}
+
+int main() {
+	constexpr u64 size = 32 * 1024 * 1024;
+
+	const char *c_cells[] = {
+		"42", "3.1415", "Berlin", "2024-05-17", "true", "customer_id",
+		"Lorem ipsum", "0xDEADBEEF", "report_final_v2.pdf",
+		"a description, which does not fit into a pool slot"
+	};
+
+	/// 8 cells per row, separated by ','
+	String s_csv;
+	String_Resize(s_csv, size);
+
+	u64 state  = 88172645463325252ull;
+	u64 length = 0;
+
+	while(length + 64 < size) {
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		/// long cells are rare
+		u64 index = state % ARRAY_COUNT(c_cells);
+
+		if (index == ARRAY_COUNT(c_cells) - 1 AND (state >> 32) % 8)
+			index = 0;
+
+		u64 length_cell = String_GetLength(c_cells[index]);
+
+		Memory_Copy(s_csv.value + length, c_cells[index], length_cell);
+		length += length_cell;
+
+		s_csv.value[length++] = ((state >> 16) % 8) ? ',' : '\n';
+	}
+
+	s_csv.length = length;
+
+	Timer timer;
+
+	/// Array_Split
+	{
+		u64 count_alloc = 0;
+
+		Time_Measure(timer, true);
+
+		Array<String> as_cells;
+		Benchmark_SplitHeap(as_cells, s_csv, ","_s, &count_alloc);
+
+		u64 count_strings = as_cells.count;
+		Array_Destroy(as_cells);
+
+		Benchmark_Print("Array_Split heap  ", count_strings, count_alloc, Time_Measure(timer, true));
+
+		u64 count_slabs = string_pool.data.count_slabs;
+
+		Time_Measure(timer, true);
+
+		as_cells = Array_Split(s_csv, ","_s, DELIMITER_IGNORE, true);
+
+		double time_pooled = Time_Measure(timer, true);
+
+		count_strings = as_cells.count;
+		count_alloc   = Benchmark_CountPooled(as_cells, count_slabs);
+
+		Time_Measure(timer, true);
+		Array_Destroy(as_cells);
+		time_pooled += Time_Measure(timer, true);
+
+		Benchmark_Print("Array_Split pooled", count_strings, count_alloc, time_pooled);
+	}
+
+	/// CSV_Load
+	{
+		u64 count_alloc   = 0;
+		u64 count_strings = 0;
+
+		Time_Measure(timer, true);
+
+		Array<String> as_rows = Array_SplitLinesRef(s_csv, false);
+		Array<Array<String>> a_csv;
+
+		FOR_ARRAY(as_rows, it_row) {
+			Array<String> as_rowitem;
+			Benchmark_SplitHeap(as_rowitem, ARRAY_IT(as_rows, it_row), ","_s, &count_alloc);
+			Array_Add(a_csv, as_rowitem);
+		}
+
+		FOR_ARRAY(a_csv, it_row) {
+			count_strings += ARRAY_IT(a_csv, it_row).count;
+			Array_Destroy(ARRAY_IT(a_csv, it_row));
+		}
+
+		Array_DestroyContainer(a_csv);
+		Array_DestroyContainer(as_rows);
+
+		Benchmark_Print("CSV_Load heap     ", count_strings, count_alloc, Time_Measure(timer, true));
+
+		u64 count_slabs = string_pool.data.count_slabs;
+
+		count_alloc   = 0;
+		count_strings = 0;
+
+		Time_Measure(timer, true);
+
+		a_csv = CSV_Load(s_csv);
+
+		double time_pooled = Time_Measure(timer, true);
+
+		FOR_ARRAY(a_csv, it_row) {
+			count_strings += ARRAY_IT(a_csv, it_row).count;
+			count_alloc   += Benchmark_CountPooled(ARRAY_IT(a_csv, it_row), string_pool.data.count_slabs);
+		}
+
+		count_alloc += string_pool.data.count_slabs - count_slabs;
+
+		Time_Measure(timer, true);
+
+		FOR_ARRAY(a_csv, it_row) {
+			Array_Destroy(ARRAY_IT(a_csv, it_row));
+		}
+
+		Array_DestroyContainer(a_csv);
+
+		time_pooled += Time_Measure(timer, true);
+
+		Benchmark_Print("CSV_Load pooled   ", count_strings, count_alloc, time_pooled);
+	}
+
+	String_Destroy(s_csv);
+
+	return 0;
+}
@@ -0,0 +1,134 @@
+#include "src/SLib.h"
+
+///
+/// String_IndexOf on a 100 MB haystack per implementation
+/// (scalar, SSE2, AVX2; long keys always use Two-Way)
+/// against comparing the key at every offset.
+///
+
+instant const char *
+Benchmark_GetName(
+	MEMORY_SIMD_TYPE type
+) {
+	switch (type) {
+		case MEMORY_SIMD_SSE2: return "SSE2  ";
+		case MEMORY_SIMD_AVX2: return "AVX2  ";
+		default:               return "Scalar";
+	}
+}
+
+/// previous String_IndexOf
+instant s64
+Benchmark_IndexOfNaive(
+	const String &s_data,
+	const String &s_key,
+	bool is_case_sensitive
+) {
+	FOR(s_data.length - s_key.length + 1, index) {
+		String s_data_ref = S(s_data);
+		String_AddOffset(s_data_ref, index);
+
+		if (String_Compare(s_data_ref, s_key, s_key.length, is_case_sensitive) == 0)
+			return index;
+	}
+
+	return -1;
+}
+
+instant void
+Benchmark_Print(
+	const char *c_name,
+	const char *c_type,
+	u64 size,
+	s64 index,
+	double time_in_ms
+) {
+	std::cout
+		<< c_name << "\t"
+		<< c_type << "\t"
+		<< (double)size / (time_in_ms / 1000.0) / Gigabyte(1) << " GB/s"
+		<< "\t(found at " << index << ")"
+		<< std::endl;
+}
+
+instant void
+Benchmark_Run(
+	const char *c_name,
+	const String &s_data,
+	const String &s_key,
+	bool is_case_sensitive
+) {
+	MEMORY_SIMD_TYPE simd_available = memory_simd;
+
+	Timer timer;
+
+	FOR((u64)simd_available + 1, it_type) {
+		memory_simd = (MEMORY_SIMD_TYPE)it_type;
+
+		Time_Measure(timer, true);
+		s64 index = String_IndexOf(s_data, s_key, 0, is_case_sensitive);
+
+		Benchmark_Print(c_name, Benchmark_GetName(memory_simd), s_data.length, index, Time_Measure(timer, true));
+	}
+
+	memory_simd = simd_available;
+
+	/// the naive search is quadratic for the periodic keys,
+	/// so it only runs on the first 10 MB and gets projected
+	String s_data_part = S(s_data);
+	s_data_part.length = MIN(s_data.length, (u64)Megabyte(10));
+
+	Time_Measure(timer, true);
+	s64 index = Benchmark_IndexOfNaive(s_data_part, s_key, is_case_sensitive);
+	double time_naive = Time_Measure(timer, true) * s_data.length / s_data_part.length;
+
+	Benchmark_Print(c_name, "Naive ", s_data.length, index, time_naive);
+}
+
+int main() {
+	constexpr u64 size = 100 * 1024 * 1024;
+
+	String s_text;
+	String_Resize(s_text, size);
+
+	/// words of random lower case letters, key is appended at the end
+	u64 state = 88172645463325252ull;
+
+	FOR(size, it) {
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		s_text.value[it] = (state % 6 == 0) ? ' ' : 'a' + (state >> 8) % 26;
+	}
+
+	const char *c_key_short = "Content-Length:";
+	const char *c_key_long  = "the quick brown fox jumps over the lazy dog, twice";
+
+	s_text.length = size;
+	Memory_Copy(s_text.value + size - 64 , c_key_short, String_GetLength(c_key_short));
+	Memory_Copy(s_text.value + size - 128, c_key_long , String_GetLength(c_key_long));
+
+	Benchmark_Run("short key         ", s_text, S(c_key_short), true);
+	Benchmark_Run("short key, no case", s_text, S("CONTENT-LENGTH:"), false);
+	Benchmark_Run("long key          ", s_text, S(c_key_long), true);
+	Benchmark_Run("long key, no case ", s_text, S("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, TWICE"), false);
+
+	/// worst case for comparing at every offset: "aaa...ab" in "aaa..."
+	String s_periodic;
+	String_Resize(s_periodic, size);
+	Memory_Set(s_periodic.value, 'a', size);
+	s_periodic.length = size;
+
+	char c_key_periodic[65] = {};
+	Memory_Set(c_key_periodic, 'a', 63);
+	c_key_periodic[63] = 'b';
+
+	Benchmark_Run("periodic 8 B      ", s_periodic, S("aaaaaaab"), true);
+	Benchmark_Run("periodic 64 B     ", s_periodic, S(c_key_periodic), true);
+
+	String_Destroy(s_text);
+	String_Destroy(s_periodic);
+
+	return 0;
+}
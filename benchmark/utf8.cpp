@@ -0,0 +1,119 @@
+#include "src/SLib.h"
+
+///
+/// UTF-8 throughput per implementation (scalar, SSE2, AVX2)
+/// for ASCII only and mixed (latin, CJK, emoji) text.
+///
+
+instant const char *
+Benchmark_GetName(
+	MEMORY_SIMD_TYPE type
+) {
+	switch (type) {
+		case MEMORY_SIMD_SSE2: return "SSE2  ";
+		case MEMORY_SIMD_AVX2: return "AVX2  ";
+		default:               return "Scalar";
+	}
+}
+
+instant void
+Benchmark_Print(
+	const char *c_name,
+	MEMORY_SIMD_TYPE type,
+	u64 size,
+	u64 result,
+	double time_in_ms
+) {
+	std::cout
+		<< c_name << "\t"
+		<< Benchmark_GetName(type) << "\t"
+		<< (double)size / (time_in_ms / 1000.0) / Gigabyte(1) << " GB/s"
+		<< "\t(" << result << ")"
+		<< std::endl;
+}
+
+instant void
+Benchmark_Run(
+	const char *c_text_name,
+	const String &s_text,
+	u32 *codepoints
+) {
+	MEMORY_SIMD_TYPE simd_available = memory_simd;
+
+	std::cout << c_text_name << std::endl;
+
+	FOR((u64)simd_available + 1, it_type) {
+		memory_simd = (MEMORY_SIMD_TYPE)it_type;
+
+		Timer timer;
+		Time_Measure(timer, true);
+
+		u64 result = String_GetLength(s_text.value, STRING_LENGTH_CODEPOINTS);
+		Benchmark_Print("    String_GetLength      ", memory_simd, s_text.length, result, Time_Measure(timer, true));
+
+		result = UTF8_IsValid(s_text);
+		Benchmark_Print("    UTF8_IsValid          ", memory_simd, s_text.length, result, Time_Measure(timer, true));
+
+		result = UTF8_GetCodepointCount(s_text);
+		Benchmark_Print("    UTF8_GetCodepointCount", memory_simd, s_text.length, result, Time_Measure(timer, true));
+
+		result = UTF8_Decode(s_text, codepoints);
+		Benchmark_Print("    UTF8_Decode           ", memory_simd, s_text.length, result, Time_Measure(timer, true));
+	}
+
+	memory_simd = simd_available;
+}
+
+int main() {
+	constexpr u64 size = 64 * 1024 * 1024;
+
+	const char *c_pieces[] = {
+		"The quick brown fox ", "jumps over the lazy dog. ",
+		"Gr\xC3\xBC\xC3\x9F" "e ", "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E ", "\xF0\x9F\x98\x80 "
+	};
+
+	String s_ascii;
+	String s_mixed;
+	String_Resize(s_ascii, size + 1);
+	String_Resize(s_mixed, size + 1);
+
+	u64 state = 88172645463325252ull;
+	u64 length_ascii = 0;
+	u64 length_mixed = 0;
+
+	while(length_mixed < size - 32) {
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		const char *c_piece = c_pieces[state % ARRAY_COUNT(c_pieces)];
+		u64 length_piece = String_GetLength(c_piece);
+
+		Memory_Copy(s_mixed.value + length_mixed, c_piece, length_piece);
+		length_mixed += length_piece;
+
+		c_piece = c_pieces[state % 2];
+		length_piece = String_GetLength(c_piece);
+
+		if (length_ascii + length_piece < size - 32) {
+			Memory_Copy(s_ascii.value + length_ascii, c_piece, length_piece);
+			length_ascii += length_piece;
+		}
+	}
+
+	s_ascii.value[length_ascii] = 0;
+	s_mixed.value[length_mixed] = 0;
+	s_ascii.length = length_ascii;
+	s_mixed.length = length_mixed;
+
+	u32 *codepoints = Memory_Create(u32, size);
+
+	Benchmark_Run("ASCII", s_ascii, codepoints);
+	Benchmark_Run("Mixed", s_mixed, codepoints);
+
+	Memory_Free(codepoints);
+	String_Destroy(s_ascii);
+	String_Destroy(s_mixed);
+
+	return 0;
+}
@@ -15,6 +15,9 @@
 #	define DEBUG_BENCHMARK		0
 #	define DEBUG_EVENT_STATUS	0
 
+/// keeps allocation statistics and dumps leaks on exit
+#	define MEMORY_TRACKING		0
+
 #else
 
 /// Log-Messages
@@ -25,6 +28,9 @@
 #	define DEBUG_BENCHMARK		0
 #	define DEBUG_EVENT_STATUS	0
 
+/// keeps allocation statistics and dumps leaks on exit
+#	define MEMORY_TRACKING		0
+
 #endif // DEBUG_MODE
 /// ===========================================================================
 
@@ -141,6 +147,8 @@
 #include <iphlpapi.h>
 #include <shlobj.h>
 #include <time.h>
+#include <immintrin.h>
+#include <type_traits>
 
 __attribute__((gnu_inline, always_inline))
 __inline__ static void debug_break(void)
@@ -435,9 +443,14 @@ MatchesAny(S &&checkAgainst, T &&...oneOf) {
 #include "core/memory.h"
 #include "core/memory_info.h"
 #include "core/memory_arena.h"
+#include "core/memory_pool.h"
+#include "core/hash.h"
 #include "core/array.h"
 #include "core/string.h"
 #include "core/array_const.h"
+#include "core/small_array.h"
+#include "core/bitset.h"
+#include "core/string_matcher.h"
 #include "core/array_string.h"
 #include "core/memory_segment.h"
 #include "core/time.h"
@@ -449,8 +462,10 @@ MatchesAny(S &&checkAgainst, T &&...oneOf) {
 #include "core/random.h"
 #include "core/mutex.h"
 #include "core/thread.h"
+#include "core/queue.h"
 #include "core/parser.h"
 #include "core/sort.h"
+#include "core/array_sorted.h"
 #include "core/rect.h"
 #include "core/cpu.h"
 #include "core/tree.h"
@@ -458,6 +473,7 @@ MatchesAny(S &&checkAgainst, T &&...oneOf) {
 #include "core/stream.h"
 #include "core/image.h"
 #include "core/map.h"
+#include "core/hash_map.h"
 
 #include "utility/base64.h"
 #include "core/network.h"
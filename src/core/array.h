@@ -1,7 +1,7 @@
 #pragma once
 
 #define ARRAY_IT(_array, _it) \
-	((_array).memory)[_it]
+	(_Array_GetMemory(_array))[_it]
 
 #define ARRAY_COUNT(_array) \
 	(sizeof(_array)/sizeof(_array[0]))
@@ -17,10 +17,50 @@
 		++_it)
 
 #define FOR_ARRAY_AUTO(_array, _it) 		            \
-	for(auto _it = &(_array).memory[0];                 \
-		(_array).count AND _it <= &(_array).memory[(_array).count - 1];    \
+	for(auto _it = _Array_GetMemory(_array);            \
+		(_array).count AND _it <= _Array_GetMemory(_array) + (_array).count - 1;    \
 		++_it)
 
+/// first element of anything with a memory member (Array, Array_Const),
+/// containers without one (SmallArray) overload it
+template <typename A>
+constexpr
+instant auto
+_Array_GetMemory(
+    A &arr
+) {
+    return arr.memory;
+}
+
+/// growth factor used by ARRAY_CAPACITY_GEOMETRIC
+#define ARRAY_CAPACITY_FACTOR_DEFAULT	2.0f
+
+/// element count per chunk used by ARRAY_CAPACITY_CHUNK
+#define ARRAY_CAPACITY_CHUNK_DEFAULT	64
+
+/// how the reserved memory grows, when
+/// adding an element to a full array
+enum ARRAY_CAPACITY_TYPE {
+    /// grows by exactly the missing amount of elements
+    ARRAY_CAPACITY_EXACT,
+    /// grows by a factor of the current capacity
+    ARRAY_CAPACITY_GEOMETRIC,
+    /// grows in multiples of a fixed element count
+    ARRAY_CAPACITY_CHUNK
+};
+
+template <typename T>
+struct Array_Index {
+    u64 (*OnHash)(const T &value) = nullptr;
+
+    /// array position + 1 (0 = empty)
+    u64  *slots    = nullptr;
+    u64   capacity = 0;
+
+    u64   count_indexed = 0;
+    bool  is_outdated   = false;
+};
+
 template <typename T>
 struct Array {
     T    *memory = 0;
@@ -29,10 +69,348 @@ struct Array {
 
     u64   last_search_index_found = 0;
 
+    ARRAY_CAPACITY_TYPE capacity_type = ARRAY_CAPACITY_GEOMETRIC;
+    float capacity_factor = ARRAY_CAPACITY_FACTOR_DEFAULT;
+    u64   capacity_chunk  = ARRAY_CAPACITY_CHUNK_DEFAULT;
+
+    /// optional, see Array_EnableIndex
+    Array_Index<T> *index = nullptr;
+
     /// f.e. for string chunks
     bool  by_reference = false;
 };
 
+/// - factor: only used for ARRAY_CAPACITY_GEOMETRIC (> 1.0)
+/// - chunk:  only used for ARRAY_CAPACITY_CHUNK     (> 0)
+template <typename T>
+constexpr
+instant void
+Array_SetCapacityPolicy(
+    Array<T> &arr,
+    ARRAY_CAPACITY_TYPE type,
+    float factor = ARRAY_CAPACITY_FACTOR_DEFAULT,
+    u64   chunk  = ARRAY_CAPACITY_CHUNK_DEFAULT
+) {
+    Assert(factor > 1.0f);
+    Assert(chunk  > 0);
+
+    arr.capacity_type   = type;
+    arr.capacity_factor = factor;
+    arr.capacity_chunk  = chunk;
+}
+
+/// makes sure there is enough memory for at least
+/// "count_required" elements, based on the capacity policy
+template <typename T>
+constexpr
+instant void
+_Array_Grow(
+    Array<T> &arr,
+    u64 count_required,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
+) {
+    if (count_required <= arr.max)
+        return;
+
+    u64 new_max = count_required;
+
+    switch (arr.capacity_type) {
+        case ARRAY_CAPACITY_GEOMETRIC: {
+            u64 t_max = (u64)(arr.max * arr.capacity_factor);
+            new_max = MAX(new_max, t_max);
+        } break;
+
+        case ARRAY_CAPACITY_CHUNK: {
+            u64 t_chunk = MAX(arr.capacity_chunk, 1);
+            new_max = ((count_required + t_chunk - 1) / t_chunk) * t_chunk;
+        } break;
+
+        case ARRAY_CAPACITY_EXACT:
+        default: {
+        } break;
+    }
+
+    arr.max = new_max;
+    arr.memory = (T *)_Memory_Resize(arr.memory,
+                                     arr.max * sizeof(T),
+                                     file,
+                                     line);
+}
+
+/// releases unused reserved memory
+template <typename T>
+constexpr
+instant void
+Array_ShrinkToFit(
+    Array<T> &arr,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
+) {
+    if (arr.max == arr.count)
+        return;
+
+    if (!arr.count) {
+        Memory_Free(arr.memory);
+        arr.max = 0;
+        return;
+    }
+
+    arr.max = arr.count;
+    arr.memory = (T *)_Memory_Resize(arr.memory,
+                                     arr.max * sizeof(T),
+                                     file,
+                                     line);
+}
+
+/// ::: Index (optional)
+/// ===========================================================================
+/// Hash table over the array positions, so finding an element does not
+/// have to compare every entry. The hash function has to be consistent
+/// with operator ==, finding with OnSearch always compares every entry.
+///
+/// Added elements get indexed on the next search. Removing single entries
+/// or ranges updates the index in place, Array_RemoveIf and sorting mark
+/// it as outdated, so it will be rebuild on the next search.
+///
+/// @Important: call Array_RebuildIndex, after changing the content
+///             of indexed elements directly (f.e. with ARRAY_IT)
+
+#define ARRAY_INDEX_CAPACITY_MIN 16
+
+template <typename T>
+constexpr
+instant u64
+_Array_IndexHash(
+    const T &value
+) {
+    return Hash_Get(value);
+}
+
+template <typename T>
+constexpr
+instant void
+_Array_IndexInsert(
+    Array<T> &arr,
+    u64 index
+) {
+    Array_Index<T> *t_index = arr.index;
+    u64 mask = t_index->capacity - 1;
+    u64 slot = t_index->OnHash(ARRAY_IT(arr, index)) & mask;
+
+    while(t_index->slots[slot])
+        slot = (slot + 1) & mask;
+
+    t_index->slots[slot] = index + 1;
+}
+
+/// indexes elements added since the last search
+template <typename T>
+constexpr
+instant void
+_Array_IndexUpdate(
+    Array<T> &arr
+) {
+    Array_Index<T> *t_index = arr.index;
+
+    if (t_index->is_outdated OR t_index->count_indexed > arr.count) {
+        Memory_Set(t_index->slots, 0, t_index->capacity * sizeof(u64));
+        t_index->count_indexed = 0;
+        t_index->is_outdated = false;
+    }
+
+    /// keep load factor at 50% or lower
+    if (!t_index->capacity OR arr.count * 2 > t_index->capacity) {
+        u64 capacity = ARRAY_INDEX_CAPACITY_MIN;
+
+        while(capacity < arr.count * 2)
+            capacity <<= 1;
+
+        Memory_Free(t_index->slots);
+        t_index->slots    = Memory_Create(u64, capacity);
+        t_index->capacity = capacity;
+        t_index->count_indexed = 0;
+    }
+
+    FOR_START(t_index->count_indexed, arr.count, it) {
+        _Array_IndexInsert(arr, it);
+    }
+
+    t_index->count_indexed = arr.count;
+}
+
+template <typename T, typename Func>
+constexpr
+instant bool
+_Array_IndexFind(
+    Array<T> &arr,
+    T &find,
+    u64 *index_opt,
+    Func OnSearch
+) {
+    _Array_IndexUpdate(arr);
+
+    Array_Index<T> *t_index = arr.index;
+    u64 mask = t_index->capacity - 1;
+    u64 slot = t_index->OnHash(find) & mask;
+
+    while(t_index->slots[slot]) {
+        u64 index = t_index->slots[slot] - 1;
+
+        if (OnSearch(ARRAY_IT(arr, index), find)) {
+            if (index_opt)
+                *index_opt = index;
+
+            return true;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    return false;
+}
+
+/// returns the slot storing the array position
+template <typename T>
+constexpr
+instant u64
+_Array_IndexFindSlot(
+    Array<T> &arr,
+    u64 index
+) {
+    Array_Index<T> *t_index = arr.index;
+    u64 mask = t_index->capacity - 1;
+    u64 slot = t_index->OnHash(ARRAY_IT(arr, index)) & mask;
+
+    while(t_index->slots[slot] != index + 1) {
+        Assert(t_index->slots[slot]);
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+/// moves following entries of the same cluster back,
+/// so no tombstones are needed
+template <typename T>
+constexpr
+instant void
+_Array_IndexErase(
+    Array<T> &arr,
+    u64 slot
+) {
+    Array_Index<T> *t_index = arr.index;
+    u64 mask = t_index->capacity - 1;
+    u64 slot_next = slot;
+
+    while(true) {
+        slot_next = (slot_next + 1) & mask;
+
+        u64 index = t_index->slots[slot_next];
+
+        if (!index)
+            break;
+
+        u64 slot_home = t_index->OnHash(ARRAY_IT(arr, index - 1)) & mask;
+
+        /// entry can be moved, if its home slot is not
+        /// (cyclically) between the free slot and itself
+        bool is_between = (slot <= slot_next)
+                            ? (slot < slot_home AND slot_home <= slot_next)
+                            : (slot < slot_home OR  slot_home <= slot_next);
+
+        if (is_between)
+            continue;
+
+        t_index->slots[slot] = index;
+        slot = slot_next;
+    }
+
+    t_index->slots[slot] = 0;
+}
+
+/// call before moving the following entries back,
+/// since the slots are found by hashing the entries
+template <typename T>
+constexpr
+instant void
+_Array_IndexRemoveRange(
+    Array<T> &arr,
+    u64 index_start,
+    u64 count
+) {
+    if (!arr.index)
+        return;
+
+    _Array_IndexUpdate(arr);
+
+    u64 index_end = index_start + count;
+
+    FOR_START(index_start, index_end, it) {
+        _Array_IndexErase(arr, _Array_IndexFindSlot(arr, it));
+    }
+
+    /// ascending, so a lowered position never matches
+    /// the position of an entry that is not updated yet
+    FOR_START(index_end, arr.count, it) {
+        arr.index->slots[_Array_IndexFindSlot(arr, it)] -= count;
+    }
+
+    arr.index->count_indexed -= count;
+}
+
+template <typename T>
+constexpr
+instant void
+_Array_IndexInvalidate(
+    Array<T> &arr
+) {
+    if (arr.index)
+        arr.index->is_outdated = true;
+}
+
+template <typename T>
+constexpr
+instant void
+Array_RebuildIndex(
+    Array<T> &arr
+) {
+    if (!arr.index)
+        return;
+
+    arr.index->is_outdated = true;
+    _Array_IndexUpdate(arr);
+}
+
+/// OnHash: defaults to Hash_Get
+template <typename T>
+constexpr
+instant void
+Array_EnableIndex(
+    Array<T> &arr,
+    u64 (*OnHash)(const T &value) = nullptr
+) {
+    if (!arr.index)
+        arr.index = Memory_Create(Array_Index<T>, 1);
+
+    arr.index->OnHash = (OnHash) ? OnHash : _Array_IndexHash<T>;
+
+    Array_RebuildIndex(arr);
+}
+
+template <typename T>
+constexpr
+instant void
+Array_DisableIndex(
+    Array<T> &arr
+) {
+    if (!arr.index)
+        return;
+
+    Memory_Free(arr.index->slots);
+    Memory_Free(arr.index);
+}
+
 template <typename T>
 constexpr
 instant void
@@ -59,15 +437,13 @@ constexpr
 instant T *
 Array_Add(
     Array<T> &arr,
-    const T element
+    const T element,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
 ) {
     constexpr u64 length = 1;
 
-    if (arr.count + length > arr.max) {
-        arr.max += length;
-        arr.memory = (T *)_Memory_Resize(arr.memory,
-                                         arr.max * sizeof(T));
-    }
+    _Array_Grow(arr, arr.count + length, file, line);
 
     arr.count += length;
     u64 target = arr.count - 1; /// convert to index
@@ -82,10 +458,12 @@ constexpr
 instant void
 Array_Add(
     Array<T> &arr,
-    std::initializer_list<T> list
+    std::initializer_list<T> list,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
 ) {
     for (const auto &item : list) {
-        Array_Add(&arr, item);
+        Array_Add(arr, item, file, line);
     }
 }
 
@@ -98,12 +476,14 @@ constexpr
 instant u64
 Array_AddEmpty(
     Array<T> &arr,
-    T **element_empty_out
+    T **element_empty_out,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
 ) {
     Assert(element_empty_out);
 
     T t_element_empty = {};
-    *element_empty_out = Array_Add(arr, t_element_empty);
+    *element_empty_out = Array_Add(arr, t_element_empty, file, line);
 
     return arr.count - 1;
 }
@@ -115,6 +495,9 @@ Array_ClearContainer(
     Array<T> &arr_out
 ) {
     arr_out.count = 0;
+
+    /// refilling to the same count would keep the old slots
+    _Array_IndexInvalidate(arr_out);
 }
 
 template<typename T>
@@ -123,6 +506,7 @@ instant void
 Array_DestroyContainer(
     Array<T> &arr_out
 ) {
+    Array_DisableIndex(arr_out);
     Memory_Free(arr_out.memory);
     arr_out = {};
 }
@@ -153,15 +537,15 @@ instant void
 Array_ReserveAdd(
     Array<T> &arr,
     u64 count_delta,
-    bool clear_zero = false
+    bool clear_zero = false,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
 ) {
     u64 old_limit = arr.max;
 
-    if (arr.count + count_delta > arr.max) {
-        arr.max += count_delta;
-        arr.memory = (T *)_Memory_Resize( arr.memory,
-                                                arr.max * sizeof(T));
-    }
+    /// same capacity policy as Array_Add, so reserving
+    /// a few elements per call does not resize every time
+    _Array_Grow(arr, arr.count + count_delta, file, line);
 
     if (clear_zero) {
         /// only clear new reserved data
@@ -177,7 +561,9 @@ instant void
 Array_Reserve(
     Array<T> &arr,
     u64 count,
-    bool clear_zero = false
+    bool clear_zero = false,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
 ) {
     u64 old_max = arr.max;
     u64 new_max = arr.count + count;
@@ -185,10 +571,12 @@ Array_Reserve(
     if (new_max > old_max) {
         arr.max = new_max;
         arr.memory = (T *)_Memory_Resize( arr.memory,
-                                                arr.max  * sizeof(T));
+                                                arr.max  * sizeof(T),
+                                                file,
+                                                line);
     }
 
-    if (clear_zero) {
+    if (clear_zero AND new_max > old_max) {
         /// only clear new reserved data
         Memory_Set( arr.memory + arr.count,
                     0,
@@ -205,6 +593,12 @@ Array_Find(
     T find,
     u64 *index = 0
 ) {
+    if (arr.index) {
+        return _Array_IndexFind(arr, find, index, [](T &element, T &find_it) {
+            return (element == find_it);
+        });
+    }
+
     /// in case of content removal
     Clamp(&arr.last_search_index_found, 0, arr.count);
 
@@ -229,6 +623,8 @@ Array_Find(
     return false;
 }
 
+/// OnSearch: does not use the index, since the hash function
+///           can not know what it compares
 template <typename T, typename F, typename Func>
 constexpr
 instant bool
@@ -273,13 +669,15 @@ instant bool
 Array_FindOrAdd(
     Array<T> &arr,
     T find,
-    T **entry_out_opt = 0
+    T **entry_out_opt = 0,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
 ) {
     u64 t_index_find;
     bool found_element = Array_Find(arr, find, &t_index_find);
 
     if (!found_element) {
-        Array_Add(arr, find);
+        Array_Add(arr, find, file, line);
         t_index_find = arr.count - 1;
     }
 
@@ -297,7 +695,9 @@ Array_FindOrAdd(
     Array<T> &arr,
     T find,
     T **entry_out,
-    Func OnSearch
+    Func OnSearch,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
 ) {
     Assert(entry_out);
 
@@ -307,7 +707,7 @@ Array_FindOrAdd(
     if (found_element) {
         *entry_out = &ARRAY_IT(arr, t_index_find);
     } else {
-        Array_AddEmpty(arr, entry_out);
+        Array_AddEmpty(arr, entry_out, file, line);
 
         /// store what you want to find, if it does not exists,
         /// so it does not have to be assigned manually all the time
@@ -323,9 +723,11 @@ instant bool
 Array_AddUnique(
     Array<T> &arr,
     T   element,
-    T** added_element = 0
+    T** added_element = 0,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
 ) {
-    return !Array_FindOrAdd(arr, element, added_element);
+    return !Array_FindOrAdd(arr, element, added_element, file, line);
 }
 
 /// Returns T, so dynamic memory can still be free'd
@@ -340,19 +742,120 @@ Array_Remove(
 
     T result = ARRAY_IT(arr, index);
 
-    /// overwrite current entry with next
-    FOR_ARRAY_START(arr, it, index) {
-        if (it + 1 >= arr.count)
-            break;
+    _Array_IndexRemoveRange(arr, index, 1);
+
+    /// move every following entry in one block
+    Memory_Copy(arr.memory + index,
+                arr.memory + index + 1,
+                (arr.count - index - 1) * sizeof(T));
 
-        ARRAY_IT(arr, it) = ARRAY_IT(arr, it + 1);
+    arr.count -= 1;
+
+    return result;
+}
+
+/// Replaces the entry with the last one,
+/// so the order of entries will not be kept.
+///
+/// Returns T, so dynamic memory can still be free'd
+template <typename T>
+constexpr
+instant T
+Array_RemoveSwap(
+    Array<T> &arr,
+    u64 index
+) {
+    Assert(index < arr.count);
+
+    T result = ARRAY_IT(arr, index);
+
+    u64 index_last = arr.count - 1;
+
+    /// keep the index up to date, instead of rebuilding it
+    if (arr.index) {
+        _Array_IndexUpdate(arr);
+        _Array_IndexErase(arr, _Array_IndexFindSlot(arr, index));
+
+        if (index != index_last)
+            arr.index->slots[_Array_IndexFindSlot(arr, index_last)] = index + 1;
+
+        arr.index->count_indexed -= 1;
     }
 
+    ARRAY_IT(arr, index) = ARRAY_IT(arr, index_last);
+
     arr.count -= 1;
 
     return result;
 }
 
+/// Dynamic memory of the removed entries has to
+/// be free'd before, if the array has ownership
+template <typename T>
+constexpr
+instant void
+Array_RemoveRange(
+    Array<T> &arr,
+    u64 index_start,
+    u64 count
+) {
+    Assert(index_start <= arr.count);
+
+    count = MIN(count, arr.count - index_start);
+
+    if (!count)
+        return;
+
+    _Array_IndexRemoveRange(arr, index_start, count);
+
+    u64 index_end = index_start + count;
+
+    Memory_Copy(arr.memory + index_start,
+                arr.memory + index_end,
+                (arr.count - index_end) * sizeof(T));
+
+    arr.count -= count;
+}
+
+/// Removes every matching entry in a single pass,
+/// while keeping the order of the remaining entries.
+///
+/// Dynamic memory of the removed entries has to be free'd
+/// inside OnRemoveIfMatch, if the array has ownership.
+///
+/// Returns the number of removed entries
+template <typename T, typename Func>
+constexpr
+instant u64
+Array_RemoveIf(
+    Array<T> &arr,
+    Func OnRemoveIfMatch
+) {
+    u64 index_keep = 0;
+
+    FOR_ARRAY(arr, it) {
+        if (OnRemoveIfMatch(ARRAY_IT(arr, it)))
+            continue;
+
+        if (index_keep != it)
+            ARRAY_IT(arr, index_keep) = ARRAY_IT(arr, it);
+
+        ++index_keep;
+    }
+
+    u64 count_removed = arr.count - index_keep;
+
+    /// entries are already overwritten, so they can not be hashed
+    /// to find their slots anymore. Rebuilding on the next search
+    /// costs O(n) like the pass above
+    if (count_removed)
+        _Array_IndexInvalidate(arr);
+
+    arr.count = index_keep;
+
+    return count_removed;
+}
+
 template <typename T>
 constexpr
 instant Array<T>
@@ -377,14 +880,9 @@ Array_Filter(
     Array<T> &a_data,
     bool (*OnKeepIfMatch) (T value)
 ) {
-    FOR_ARRAY(a_data, it) {
-        T t_data = ARRAY_IT(a_data, it);
-
-        if (!OnKeepIfMatch(t_data)) {
-            Array_Remove(a_data, it);
-            --it;
-        }
-    }
+    Array_RemoveIf(a_data, [&](const T &value) {
+        return !OnKeepIfMatch(value);
+    });
 }
 
 template <typename T, typename Func>
@@ -394,14 +892,10 @@ Array_Filter(
     Array<T> &a_data,
     Func OnKeepIfMatch
 ) {
-    FOR_ARRAY(a_data, it) {
-        T t_data = ARRAY_IT(a_data, it);
-
-        if (!OnKeepIfMatch(t_data)) {
-            Array_Remove(a_data, it);
-            --it;
-        }
-    }
+    /// auto &, so predicates taking T & still compile
+    Array_RemoveIf(a_data, [&](auto &value) {
+        return !OnKeepIfMatch(value);
+    });
 }
 
 template <typename T, typename Func>
@@ -411,21 +905,16 @@ Array_Filter(
     Array<T> &a_data,
     Array<Func> a_OnKeepIfMatch
 ) {
-    FOR_ARRAY(a_data, it_data) {
-        T t_data = ARRAY_IT(a_data, it_data);
-
+    Array_RemoveIf(a_data, [&](auto &value) {
         FOR_ARRAY(a_OnKeepIfMatch, it_func) {
             Func OnKeepIfMatch = ARRAY_IT(a_OnKeepIfMatch, it_func);
 
-            bool result = OnKeepIfMatch(t_data);
-
-            if (!result) {
-                Array_Remove(a_data, it_data);
-                --it_data;
-                break;
-            }
+            if (!OnKeepIfMatch(value))
+                return true;
         }
-    }
+
+        return false;
+    });
 }
 
 template <typename T>
@@ -0,0 +1,512 @@
+#pragma once
+
+/// Algorithms on arrays, which are sorted by OnCompare.
+///
+/// OnCompare: see Array_Sort (the overloads without OnCompare use
+///            operator < and expect ascending order)
+///
+/// Results are undefined, if the array is not sorted
+/// with the same comparator.
+
+#define ARRAY_SORTED_ASCENDING [](const T &one, const T &two) { return (one < two); }
+
+template <typename T, typename Func>
+instant bool
+Array_IsSorted(
+    Array<T> &arr,
+    Func OnCompare
+) {
+    FOR_ARRAY_START(arr, it, 1) {
+        if (_Sort_IsLess(OnCompare, ARRAY_IT(arr, it), ARRAY_IT(arr, it - 1)))
+            return false;
+    }
+
+    return true;
+}
+
+template <typename T>
+instant bool
+Array_IsSorted(
+    Array<T> &arr
+) {
+    return Array_IsSorted(arr, ARRAY_SORTED_ASCENDING);
+}
+
+/// returns the index of the first element, which is not less than value
+/// (or arr.count)
+///
+/// branchless: the loop always runs log2(count) times and
+/// the comparison result selects the half (cmov), so there
+/// are no mispredicted branches on random lookups
+template <typename T, typename Func>
+instant u64
+Array_LowerBound(
+    Array<T> &arr,
+    T value,
+    Func OnCompare
+) {
+    if (!arr.count)
+        return 0;
+
+    T  *base  = arr.memory;
+    u64 count = arr.count;
+
+    while(count > 1) {
+        u64 half = count / 2;
+
+        base   = (_Sort_IsLess(OnCompare, base[half], value)) ? base + half : base;
+        count -= half;
+    }
+
+    return (base - arr.memory) + _Sort_IsLess(OnCompare, *base, value);
+}
+
+template <typename T>
+instant u64
+Array_LowerBound(
+    Array<T> &arr,
+    T value
+) {
+    return Array_LowerBound(arr, value, ARRAY_SORTED_ASCENDING);
+}
+
+/// returns the index of the first element, which is greater than value
+/// (or arr.count)
+template <typename T, typename Func>
+instant u64
+Array_UpperBound(
+    Array<T> &arr,
+    T value,
+    Func OnCompare
+) {
+    if (!arr.count)
+        return 0;
+
+    T  *base  = arr.memory;
+    u64 count = arr.count;
+
+    while(count > 1) {
+        u64 half = count / 2;
+
+        base   = (!_Sort_IsLess(OnCompare, value, base[half])) ? base + half : base;
+        count -= half;
+    }
+
+    return (base - arr.memory) + !_Sort_IsLess(OnCompare, value, *base);
+}
+
+template <typename T>
+instant u64
+Array_UpperBound(
+    Array<T> &arr,
+    T value
+) {
+    return Array_UpperBound(arr, value, ARRAY_SORTED_ASCENDING);
+}
+
+/// binary search version of Array_Find
+template <typename T, typename Func>
+instant bool
+Array_FindSorted(
+    Array<T> &arr,
+    T value,
+    u64 *index_out,
+    Func OnCompare
+) {
+    u64 index = Array_LowerBound(arr, value, OnCompare);
+
+    if (    index == arr.count
+        OR _Sort_IsLess(OnCompare, value, ARRAY_IT(arr, index)))
+        return false;
+
+    if (index_out)
+        *index_out = index;
+
+    return true;
+}
+
+template <typename T>
+instant bool
+Array_FindSorted(
+    Array<T> &arr,
+    T value,
+    u64 *index_out = 0
+) {
+    return Array_FindSorted(arr, value, index_out, ARRAY_SORTED_ASCENDING);
+}
+
+/// inserts behind equal elements, so insertion order is kept
+///
+/// returns the index of the inserted element
+template <typename T, typename Func>
+instant u64
+Array_InsertSorted(
+    Array<T> &arr,
+    T element,
+    Func OnCompare
+) {
+    u64 index = Array_UpperBound(arr, element, OnCompare);
+
+    Array_Add(arr, element);
+
+    _Array_IndexInvalidate(arr);
+
+    /// move every following entry in one block
+    Memory_Copy(arr.memory + index + 1,
+                arr.memory + index,
+                (arr.count - index - 1) * sizeof(T));
+
+    ARRAY_IT(arr, index) = element;
+
+    return index;
+}
+
+template <typename T>
+instant u64
+Array_InsertSorted(
+    Array<T> &arr,
+    T element
+) {
+    return Array_InsertSorted(arr, element, ARRAY_SORTED_ASCENDING);
+}
+
+/// merges both arrays into a_merged_out (cleared before),
+/// elements of a_first come before equal elements of a_second
+template <typename T, typename Func>
+instant void
+Array_MergeSorted(
+    Array<T> &a_first,
+    Array<T> &a_second,
+    Array<T> &a_merged_out,
+    Func OnCompare
+) {
+    Assert(&a_merged_out != &a_first);
+    Assert(&a_merged_out != &a_second);
+
+    Array_ClearContainer(a_merged_out);
+    _Array_IndexInvalidate(a_merged_out);
+    Array_Reserve(a_merged_out, a_first.count + a_second.count);
+
+    u64 index_first  = 0;
+    u64 index_second = 0;
+
+    while(index_first < a_first.count AND index_second < a_second.count) {
+        T &first  = ARRAY_IT(a_first , index_first);
+        T &second = ARRAY_IT(a_second, index_second);
+
+        if (_Sort_IsLess(OnCompare, second, first)) {
+            Array_Add(a_merged_out, second);
+            ++index_second;
+        }
+        else {
+            Array_Add(a_merged_out, first);
+            ++index_first;
+        }
+    }
+
+    FOR_START(index_first, a_first.count, it) {
+        Array_Add(a_merged_out, ARRAY_IT(a_first, it));
+    }
+
+    FOR_START(index_second, a_second.count, it) {
+        Array_Add(a_merged_out, ARRAY_IT(a_second, it));
+    }
+}
+
+template <typename T>
+instant void
+Array_MergeSorted(
+    Array<T> &a_first,
+    Array<T> &a_second,
+    Array<T> &a_merged_out
+) {
+    Array_MergeSorted(a_first, a_second, a_merged_out, ARRAY_SORTED_ASCENDING);
+}
+
+/// elements, which are in a_first or a_second
+///
+/// duplicates are kept as often, as they occur in either array
+/// (f.e. [1, 1, 2] and [1, 3] -> [1, 1, 2, 3])
+template <typename T, typename Func>
+instant void
+Array_SetUnion(
+    Array<T> &a_first,
+    Array<T> &a_second,
+    Array<T> &a_union_out,
+    Func OnCompare
+) {
+    Assert(&a_union_out != &a_first);
+    Assert(&a_union_out != &a_second);
+
+    Array_ClearContainer(a_union_out);
+    _Array_IndexInvalidate(a_union_out);
+
+    u64 index_first  = 0;
+    u64 index_second = 0;
+
+    while(index_first < a_first.count AND index_second < a_second.count) {
+        T &first  = ARRAY_IT(a_first , index_first);
+        T &second = ARRAY_IT(a_second, index_second);
+
+        if (_Sort_IsLess(OnCompare, first, second)) {
+            Array_Add(a_union_out, first);
+            ++index_first;
+        }
+        else
+        if (_Sort_IsLess(OnCompare, second, first)) {
+            Array_Add(a_union_out, second);
+            ++index_second;
+        }
+        else {
+            Array_Add(a_union_out, first);
+            ++index_first;
+            ++index_second;
+        }
+    }
+
+    FOR_START(index_first, a_first.count, it) {
+        Array_Add(a_union_out, ARRAY_IT(a_first, it));
+    }
+
+    FOR_START(index_second, a_second.count, it) {
+        Array_Add(a_union_out, ARRAY_IT(a_second, it));
+    }
+}
+
+template <typename T>
+instant void
+Array_SetUnion(
+    Array<T> &a_first,
+    Array<T> &a_second,
+    Array<T> &a_union_out
+) {
+    Array_SetUnion(a_first, a_second, a_union_out, ARRAY_SORTED_ASCENDING);
+}
+
+/// elements of a_first, which are also in a_second
+template <typename T, typename Func>
+instant void
+Array_SetIntersection(
+    Array<T> &a_first,
+    Array<T> &a_second,
+    Array<T> &a_intersection_out,
+    Func OnCompare
+) {
+    Assert(&a_intersection_out != &a_first);
+    Assert(&a_intersection_out != &a_second);
+
+    Array_ClearContainer(a_intersection_out);
+    _Array_IndexInvalidate(a_intersection_out);
+
+    u64 index_first  = 0;
+    u64 index_second = 0;
+
+    while(index_first < a_first.count AND index_second < a_second.count) {
+        T &first  = ARRAY_IT(a_first , index_first);
+        T &second = ARRAY_IT(a_second, index_second);
+
+        if (_Sort_IsLess(OnCompare, first, second)) {
+            ++index_first;
+        }
+        else
+        if (_Sort_IsLess(OnCompare, second, first)) {
+            ++index_second;
+        }
+        else {
+            Array_Add(a_intersection_out, first);
+            ++index_first;
+            ++index_second;
+        }
+    }
+}
+
+template <typename T>
+instant void
+Array_SetIntersection(
+    Array<T> &a_first,
+    Array<T> &a_second,
+    Array<T> &a_intersection_out
+) {
+    Array_SetIntersection(a_first, a_second, a_intersection_out, ARRAY_SORTED_ASCENDING);
+}
+
+/// elements of a_first, which are not in a_second
+template <typename T, typename Func>
+instant void
+Array_SetDifference(
+    Array<T> &a_first,
+    Array<T> &a_second,
+    Array<T> &a_difference_out,
+    Func OnCompare
+) {
+    Assert(&a_difference_out != &a_first);
+    Assert(&a_difference_out != &a_second);
+
+    Array_ClearContainer(a_difference_out);
+    _Array_IndexInvalidate(a_difference_out);
+
+    u64 index_first  = 0;
+    u64 index_second = 0;
+
+    while(index_first < a_first.count AND index_second < a_second.count) {
+        T &first  = ARRAY_IT(a_first , index_first);
+        T &second = ARRAY_IT(a_second, index_second);
+
+        if (_Sort_IsLess(OnCompare, first, second)) {
+            Array_Add(a_difference_out, first);
+            ++index_first;
+        }
+        else
+        if (_Sort_IsLess(OnCompare, second, first)) {
+            ++index_second;
+        }
+        else {
+            ++index_first;
+            ++index_second;
+        }
+    }
+
+    FOR_START(index_first, a_first.count, it) {
+        Array_Add(a_difference_out, ARRAY_IT(a_first, it));
+    }
+}
+
+template <typename T>
+instant void
+Array_SetDifference(
+    Array<T> &a_first,
+    Array<T> &a_second,
+    Array<T> &a_difference_out
+) {
+    Array_SetDifference(a_first, a_second, a_difference_out, ARRAY_SORTED_ASCENDING);
+}
+
+/// ::: Eytzinger layout
+/// ===========================================================================
+/// The sorted elements get stored in breadth-first order of a
+/// binary search tree (children of k at 2k and 2k + 1, 1-based).
+/// The first levels of every search share the same few cache lines and
+/// the next levels can be prefetched, which makes lookups into large,
+/// read-mostly tables faster than a binary search on the sorted array.
+
+#define ARRAY_EYTZINGER_CACHE_LINE 64
+
+/// the descendants d levels below an element are 2^d elements next to
+/// each other, so prefetch as many levels ahead as fit one cache line
+/// (f.e. 16 elements for T = u32, 8 for T = u64, at least 2)
+template <typename T>
+constexpr
+instant u64
+_Array_EytzingerPrefetchCount() {
+    u64 count = 2;
+
+    while(count * 2 * sizeof(T) <= ARRAY_EYTZINGER_CACHE_LINE)
+        count *= 2;
+
+    return count;
+}
+
+template <typename T>
+instant void
+_Array_EytzingerFill(
+    Array<T> &a_sorted,
+    Array<T> &a_layout_out,
+    u64 &index_sorted,
+    u64 index_layout
+) {
+    if (index_layout > a_sorted.count)
+        return;
+
+    _Array_EytzingerFill(a_sorted, a_layout_out, index_sorted, index_layout * 2);
+
+    ARRAY_IT(a_layout_out, index_layout - 1) = ARRAY_IT(a_sorted, index_sorted);
+    ++index_sorted;
+
+    _Array_EytzingerFill(a_sorted, a_layout_out, index_sorted, index_layout * 2 + 1);
+}
+
+/// a_sorted has to be sorted, a_layout_out gets overwritten
+template <typename T>
+instant void
+Array_ToEytzinger(
+    Array<T> &a_sorted,
+    Array<T> &a_layout_out
+) {
+    Assert(&a_layout_out != &a_sorted);
+
+    Array_ClearContainer(a_layout_out);
+    _Array_IndexInvalidate(a_layout_out);
+    Array_Reserve(a_layout_out, a_sorted.count);
+
+    a_layout_out.count = a_sorted.count;
+
+    u64 index_sorted = 0;
+    _Array_EytzingerFill(a_sorted, a_layout_out, index_sorted, 1);
+}
+
+/// returns the index (in the layout) of the first element,
+/// which is not less than value (or a_layout.count)
+template <typename T, typename Func>
+instant u64
+Array_EytzingerLowerBound(
+    Array<T> &a_layout,
+    T value,
+    Func OnCompare
+) {
+    constexpr u64 count_prefetch = _Array_EytzingerPrefetchCount<T>();
+
+    u64 index = 1;
+
+    while(index <= a_layout.count) {
+        __builtin_prefetch(a_layout.memory + index * count_prefetch - 1);
+
+        index = index * 2 + _Sort_IsLess(OnCompare, ARRAY_IT(a_layout, index - 1), value);
+    }
+
+    /// go back up the right turns, to the last left turn,
+    /// which was the last element not less than value
+    index >>= __builtin_ffsll(~index);
+
+    return (index) ? index - 1 : a_layout.count;
+}
+
+template <typename T>
+instant u64
+Array_EytzingerLowerBound(
+    Array<T> &a_layout,
+    T value
+) {
+    return Array_EytzingerLowerBound(a_layout, value, ARRAY_SORTED_ASCENDING);
+}
+
+template <typename T, typename Func>
+instant bool
+Array_EytzingerFind(
+    Array<T> &a_layout,
+    T value,
+    u64 *index_out,
+    Func OnCompare
+) {
+    u64 index = Array_EytzingerLowerBound(a_layout, value, OnCompare);
+
+    if (    index == a_layout.count
+        OR _Sort_IsLess(OnCompare, value, ARRAY_IT(a_layout, index)))
+        return false;
+
+    if (index_out)
+        *index_out = index;
+
+    return true;
+}
+
+template <typename T>
+instant bool
+Array_EytzingerFind(
+    Array<T> &a_layout,
+    T value,
+    u64 *index_out = 0
+) {
+    return Array_EytzingerFind(a_layout, value, index_out, ARRAY_SORTED_ASCENDING);
+}
+
+#undef ARRAY_SORTED_ASCENDING
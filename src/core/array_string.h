@@ -12,15 +12,13 @@ constexpr
 instant String *
 Array_Add(
     Array<String> &arr,
-    String &element
+    String &element,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
 ) {
     constexpr u64 length = 1;
 
-    if (arr.count + length > arr.max) {
-        arr.max += length;
-        arr.memory = (String *)_Memory_Resize(arr.memory,
-                                              arr.max * sizeof(String));
-    }
+    _Array_Grow(arr, arr.count + length, file, line);
 
     arr.count += length;
     u64 target = arr.count - 1; /// convert to index
@@ -38,13 +36,15 @@ constexpr
 instant Array<String *>
 Array_Add(
     Array<String> &arr,
-    std::initializer_list<String> list
+    std::initializer_list<String> list,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
 ) {
     Array<String *> as_result;
 
     for (const auto &item : list) {
-        auto pItem = Array_Add(arr, item);
-        Array_Add(as_result, pItem);
+        auto pItem = Array_Add(arr, item, file, line);
+        Array_Add(as_result, pItem, file, line);
     }
 
     return as_result;
@@ -166,6 +166,8 @@ Array_SplitBuffer(
 	DELIMITER_TYPE type,
 	bool add_empty_entry
 ) {
+	MEMORY_TAG("Array_Split");
+
 	Array_Clear(as_buffer_out);
 
 	String s_data_it = S(s_data);
@@ -237,8 +239,15 @@ Array_SplitLinesRef(
 	String s_data_it = S(s_data);
 
 	while(!String_IsEmpty(s_data_it)) {
-		s64 index        = String_IndexOf(s_data_it, S("\r"), 0, true);
-		s64 index_return = String_IndexOf(s_data_it, S("\n"), 0, true);
+		s64 index_return = String_IndexOf(s_data_it, "\n"_s, 0, true);
+		s64 index        = -1;
+
+		/// only a "\r" in front of the next "\n" matters, so the
+		/// remaining data does not get scanned again for every line
+		if (index_return != 0) {
+			String s_data_line = S(s_data_it, (index_return > 0) ? index_return : s_data_it.length);
+			index = String_IndexOf(s_data_line, "\r"_s, 0, true);
+		}
 
 		bool found_carriage = true;
 
@@ -267,7 +276,7 @@ Array_SplitLinesRef(
 
 		/// skip "\n" in "\r\n"
 		if (    found_carriage
-			AND String_IndexOf(s_data_it, S("\n"), 0, true) == 0
+			AND String_IndexOf(s_data_it, "\n"_s, 0, true) == 0
 		) {
 			String_AddOffset(s_data_it, 1);
 		}
@@ -343,48 +352,99 @@ Array_SplitWordsBuffer(
 	return number_of_linebreaks;
 }
 
+/// below, a String_IndexOf per delimiter is faster than
+/// building a StringMatcher for a single search
+#define ARRAY_FIND_STRING_SCAN_COUNT_MAX	8
+#define ARRAY_FIND_STRING_SCAN_LENGTH_MAX	16
+
+/// one String_IndexOf per delimiter, the lower index wins
+/// when more delimiters start at the same position
+instant bool
+_Array_FindFirstStringScan(
+	const String &s_data,
+	const Array<String> &as_find,
+	s64 *index_delimiter_used_out,
+	s64 *index_found_out,
+	s64 pos_start
+) {
+	s64 index_lowest = s_data.length;
+	s64 t_index_delimiter_used = -1;
+
+	FOR_ARRAY(as_find, it) {
+		const String &ts_find = ARRAY_IT(as_find, it);
+		s64 t_index_found = String_IndexOf(s_data, ts_find, pos_start, true);
+
+		if (t_index_found >= 0 AND t_index_found < index_lowest) {
+			index_lowest = t_index_found;
+			t_index_delimiter_used = it;
+		}
+	}
+
+	if (index_delimiter_used_out)
+		*index_delimiter_used_out = t_index_delimiter_used;
+
+	if (index_found_out)
+		*index_found_out = index_lowest;
+
+	return (t_index_delimiter_used >= 0);
+}
+
+/// matcher: created from the delimiters, for repeated searches
 instant bool
 Array_FindFirstString(
 	String *s_data,
-	Array<String> *as_find,
+	const StringMatcher &matcher,
 	s64 *index_delimiter_used_out = 0,
 	s64 *index_found_out = 0,
 	s64 pos_start = 0
 ) {
 	Assert(s_data);
-	Assert(as_find);
 
-	s64 index_lowest = s_data->length;
+	StringMatcher_Match match;
+	bool found = StringMatcher_FindFirst(matcher, *s_data, &match, MAX(pos_start, (s64)0));
 
-	s64 t_index_delimiter_used = -1;
+	if (index_delimiter_used_out)
+		*index_delimiter_used_out = (found) ? (s64)match.pattern : -1;
 
-	FOR_ARRAY(*as_find, it) {
-		String *ts_find = &ARRAY_IT(*as_find, it);
-		s64 t_index_found = String_IndexOf(*s_data, *ts_find, 0, true);
+	if (index_found_out)
+		*index_found_out = (found) ? (s64)match.index : (s64)s_data->length;
 
-		if (t_index_found >= 0) {
-			if (t_index_found < index_lowest) {
-			 	t_index_delimiter_used = it;
-			}
+	return found;
+}
 
-			index_lowest = MIN(index_lowest, t_index_found);
-		}
-	}
+instant bool
+Array_FindFirstString(
+	String *s_data,
+	Array<String> *as_find,
+	s64 *index_delimiter_used_out = 0,
+	s64 *index_found_out = 0,
+	s64 pos_start = 0
+) {
+	Assert(s_data);
+	Assert(as_find);
 
-	if (index_delimiter_used_out)
-		*index_delimiter_used_out = t_index_delimiter_used;
+	bool is_short = (as_find->count <= ARRAY_FIND_STRING_SCAN_COUNT_MAX);
 
-	if (t_index_delimiter_used < 0) {
-		if (index_found_out)
-			*index_found_out = index_lowest;
+	FOR_ARRAY(*as_find, it) {
+		if (ARRAY_IT(*as_find, it).length > ARRAY_FIND_STRING_SCAN_LENGTH_MAX)
+			is_short = false;
+	}
 
-		return false;
+	if (is_short) {
+		return _Array_FindFirstStringScan(*s_data, *as_find, index_delimiter_used_out,
+										  index_found_out, MAX(pos_start, (s64)0));
 	}
 
-	if (index_found_out)
-		*index_found_out = index_lowest;
+	/// all delimiters in a single pass
+	StringMatcher matcher;
+	StringMatcher_Create(matcher, *as_find);
+
+	bool found = Array_FindFirstString(s_data, matcher, index_delimiter_used_out,
+									   index_found_out, pos_start);
+
+	StringMatcher_Destroy(matcher);
 
-	return true;
+	return found;
 }
 
 instant String
@@ -0,0 +1,282 @@
+#pragma once
+
+/// Fixed-size set of N bits, f.e. one bit per key instead of one bool.
+///
+/// Storage is rounded up to whole 256 bit blocks, so clearing and
+/// scanning work on full SSE2 / AVX2 registers (see memory_simd)
+/// without handling a tail. Bits above N stay 0.
+///
+/// Reading a bit also works with operator [], so it can replace
+/// a bool array without changing every read access.
+///
+/// Without the SLib.h prelude (f.e. test/bitset_headless.cpp on Linux)
+/// the few parts used here are defined locally.
+
+#include <immintrin.h>
+
+#ifndef instant
+#include <assert.h>
+
+#define u32		unsigned int
+#define u64		unsigned long long
+#define AND		&&
+#define OR		||
+#define instant	static inline
+
+#define FOR(_max, _it)					\
+	for(u64 _it = 0; _it < (_max); ++_it)
+
+#define FOR_START(_start, _max, _it)	\
+	for(u64 _it = _start; _it < _max; ++_it)
+
+#define Assert(EX)	assert(EX)
+
+/// normally declared in memory.h
+enum MEMORY_SIMD_TYPE {
+	MEMORY_SIMD_NONE,
+	MEMORY_SIMD_SSE2,
+	MEMORY_SIMD_AVX2
+};
+
+inline MEMORY_SIMD_TYPE memory_simd = MEMORY_SIMD_NONE;
+#endif // instant
+
+#define BITSET_WORD_BITS	64
+#define BITSET_BLOCK_WORDS	4
+
+template <u64 N>
+struct BitSet {
+	static constexpr u64 count_words = ((N + 255) / 256) * BITSET_BLOCK_WORDS;
+
+	alignas(32) u64 words[count_words] = {};
+
+	constexpr bool
+	operator [] (
+		u64 index
+	) const {
+		Assert(index < N);
+
+		return (words[index / BITSET_WORD_BITS] >> (index % BITSET_WORD_BITS)) & 1;
+	}
+};
+
+template <u64 N>
+constexpr
+instant bool
+BitSet_Get(
+	const BitSet<N> &bitset,
+	u64 index
+) {
+	Assert(index < N);
+
+	return bitset[index];
+}
+
+template <u64 N>
+constexpr
+instant void
+BitSet_Set(
+	BitSet<N> &bitset,
+	u64 index,
+	bool value = true
+) {
+	Assert(index < N);
+
+	u64 &word = bitset.words[index / BITSET_WORD_BITS];
+	u64  mask = (u64)1 << (index % BITSET_WORD_BITS);
+
+	word = (value) ? (word | mask) : (word & ~mask);
+}
+
+template <u64 N>
+constexpr
+instant void
+BitSet_Toggle(
+	BitSet<N> &bitset,
+	u64 index
+) {
+	Assert(index < N);
+
+	bitset.words[index / BITSET_WORD_BITS] ^= (u64)1 << (index % BITSET_WORD_BITS);
+}
+
+__attribute__((target("sse2")))
+instant void
+_BitSet_ClearSSE2(
+	u64 *words,
+	u64 count_words
+) {
+	__m128i zero = _mm_setzero_si128();
+
+	for(u64 it = 0; it < count_words; it += 2)
+		_mm_storeu_si128((__m128i *)(words + it), zero);
+}
+
+__attribute__((target("avx2")))
+instant void
+_BitSet_ClearAVX2(
+	u64 *words,
+	u64 count_words
+) {
+	__m256i zero = _mm256_setzero_si256();
+
+	for(u64 it = 0; it < count_words; it += BITSET_BLOCK_WORDS)
+		_mm256_storeu_si256((__m256i *)(words + it), zero);
+}
+
+template <u64 N>
+instant void
+BitSet_ClearAll(
+	BitSet<N> &bitset_out
+) {
+	switch (memory_simd) {
+		case MEMORY_SIMD_AVX2: {
+			_BitSet_ClearAVX2(bitset_out.words, bitset_out.count_words);
+		} break;
+
+		case MEMORY_SIMD_SSE2: {
+			_BitSet_ClearSSE2(bitset_out.words, bitset_out.count_words);
+		} break;
+
+		default: {
+			FOR(bitset_out.count_words, it) {
+				bitset_out.words[it] = 0;
+			}
+		} break;
+	}
+}
+
+/// returns the index of the first word, which is not 0
+/// (or count_words), starting at word_start (block aligned)
+__attribute__((target("sse2")))
+instant u64
+_BitSet_FindWordSSE2(
+	const u64 *words,
+	u64 count_words,
+	u64 word_start
+) {
+	__m128i zero = _mm_setzero_si128();
+
+	for(u64 it = word_start; it < count_words; it += 2) {
+		__m128i data = _mm_loadu_si128((const __m128i *)(words + it));
+
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(data, zero)) != 0xFFFF)
+			return (words[it]) ? it : it + 1;
+	}
+
+	return count_words;
+}
+
+__attribute__((target("avx2")))
+instant u64
+_BitSet_FindWordAVX2(
+	const u64 *words,
+	u64 count_words,
+	u64 word_start
+) {
+	for(u64 it = word_start; it < count_words; it += BITSET_BLOCK_WORDS) {
+		__m256i data = _mm256_loadu_si256((const __m256i *)(words + it));
+
+		if (!_mm256_testz_si256(data, data)) {
+			FOR(BITSET_BLOCK_WORDS, it_word) {
+				if (words[it + it_word])
+					return it + it_word;
+			}
+		}
+	}
+
+	return count_words;
+}
+
+instant u64
+_BitSet_FindWord(
+	const u64 *words,
+	u64 count_words,
+	u64 word_start
+) {
+	switch (memory_simd) {
+		case MEMORY_SIMD_AVX2: {
+			return _BitSet_FindWordAVX2(words, count_words, word_start);
+		} break;
+
+		case MEMORY_SIMD_SSE2: {
+			return _BitSet_FindWordSSE2(words, count_words, word_start);
+		} break;
+
+		default: {
+			FOR_START(word_start, count_words, it) {
+				if (words[it])
+					return it;
+			}
+		} break;
+	}
+
+	return count_words;
+}
+
+template <u64 N>
+instant bool
+BitSet_IsAny(
+	const BitSet<N> &bitset
+) {
+	return (_BitSet_FindWord(bitset.words, bitset.count_words, 0) < bitset.count_words);
+}
+
+template <u64 N>
+instant bool
+BitSet_IsNone(
+	const BitSet<N> &bitset
+) {
+	return !BitSet_IsAny(bitset);
+}
+
+/// returns false, if no bit is set at or after index_start
+template <u64 N>
+instant bool
+BitSet_FindFirst(
+	const BitSet<N> &bitset,
+	u64 *index_out,
+	u64 index_start = 0
+) {
+	Assert(index_out);
+
+	if (index_start >= N)
+		return false;
+
+	u64 word_index = index_start / BITSET_WORD_BITS;
+
+	/// bits of the first word before index_start are ignored
+	u64 word = bitset.words[word_index] & (~(u64)0 << (index_start % BITSET_WORD_BITS));
+
+	/// scan the rest of the block, then continue block-wise
+	while(!word) {
+		++word_index;
+
+		if (word_index % BITSET_BLOCK_WORDS == 0) {
+			word_index = _BitSet_FindWord(bitset.words, bitset.count_words, word_index);
+		}
+
+		if (word_index >= bitset.count_words)
+			return false;
+
+		word = bitset.words[word_index];
+	}
+
+	*index_out = word_index * BITSET_WORD_BITS + __builtin_ctzll(word);
+
+	return true;
+}
+
+template <u64 N>
+instant u64
+BitSet_Count(
+	const BitSet<N> &bitset
+) {
+	u64 result = 0;
+
+	FOR(bitset.count_words, it) {
+		result += __builtin_popcountll(bitset.words[it]);
+	}
+
+	return result;
+}
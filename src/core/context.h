@@ -15,19 +15,61 @@ struct Context {
     MemoryArena arena_temp;
     MemoryArena arena_pool;
     MemoryArena *arena_current = &arena_pool;
+
+    /// clear the flush arena with every Context_OnFrame call
+    bool flush_per_frame = true;
+};
+
+/// releases the arenas of a thread, when it ends
+struct Context_ThreadExit {
+    bool is_active = false;
+
+    ~Context_ThreadExit();
 };
 
+inline thread_local Context_ThreadExit context_thread_exit;
+
 Context Context_Init() {
     Context context;
 
-    context.arena_flush = MemoryArena_Create(Gigabyte(1), "Flush");
-    context.arena_temp  = MemoryArena_Create(Gigabyte(1), "Temp");
-    context.arena_pool  = MemoryArena_Create(Gigabyte(1), "Pool");
+    /// reserved only, physical memory gets committed while allocating
+    context.arena_flush = MemoryArena_CreateVirtual(Gigabyte(1), "Flush", Megabyte(64));
+    context.arena_temp  = MemoryArena_CreateVirtual(Gigabyte(1), "Temp" , Megabyte(64));
+    context.arena_pool  = MemoryArena_CreateVirtual(Gigabyte(1), "Pool");
+
+    context_thread_exit.is_active = true;
 
     return context;
 }
 
-inline Context context = Context_Init();
+/// Every thread has its own context (and arenas), which gets
+/// created on first use. So MemoryArena_Alloc can be used from
+/// threads created with Thread_Create without locking.
+inline thread_local Context context = Context_Init();
+
+instant void
+Context_Free(
+    Context &context_out
+) {
+    MemoryArena_Free(context_out.arena_flush);
+    MemoryArena_Free(context_out.arena_temp);
+    MemoryArena_Free(context_out.arena_pool);
+}
+
+inline
+Context_ThreadExit::~Context_ThreadExit() {
+    if (is_active)
+        Context_Free(context);
+}
+
+/// call once per frame (f.e. done in Window_ReadMessage)
+/// for the current thread
+instant void
+Context_OnFrame(
+) {
+    if (context.flush_per_frame)
+        MemoryArena_Clear(context.arena_flush);
+}
 
 instant void *
 MemoryArena_Alloc (
@@ -36,6 +78,32 @@ MemoryArena_Alloc (
     return _MemoryArena_Alloc(*context.arena_current, size);
 }
 
+/// alignment: has to be a power of 2
+instant void *
+MemoryArena_AllocAligned (
+    u64 size,
+    u64 alignment
+) {
+    return _MemoryArena_AllocAligned(*context.arena_current, size, alignment);
+}
+
+/// Usage:
+///     auto marker = MemoryArena_Mark();
+///     ... temporary allocations ...
+///     MemoryArena_Rewind(marker);
+instant MemoryArena_Marker
+MemoryArena_Mark(
+) {
+    return MemoryArena_Mark(*context.arena_current);
+}
+
+instant void
+MemoryArena_Rewind(
+    const MemoryArena_Marker &marker
+) {
+    MemoryArena_Rewind(*context.arena_current, marker);
+}
+
 instant MemoryArena*
 Context_GetArena(Context_Arena_Type type) {
     switch (type) {
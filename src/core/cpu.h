@@ -24,6 +24,8 @@ struct CPU_Features {
 	bool sse3;
 	bool sse4_1;
 	bool sse4_2;
+	bool avx;
+	bool avx2;
 	bool _3dnow;
 	bool _3dnow_ext;
 };
@@ -43,6 +45,21 @@ CPU_GetID(
     return cpu_id_out;
 }
 
+/// extended control register (f.e. to check if the os
+/// saves the AVX registers on context switches)
+instant u64
+CPU_GetXCR(
+	u32 id
+) {
+	u32 lo = 0;
+	u32 hi = 0;
+
+	asm volatile
+		("xgetbv" : "=a" (lo), "=d" (hi) : "c" (id));
+
+	return ((u64)hi << 32) | lo;
+}
+
 instant String
 CPU_GetVendor() {
 	auto cpu_id = CPU_GetID(0);
@@ -79,6 +96,7 @@ CPU_GetFeatures() {
 	bool is_Intel = (s_vendor == "GenuineIntel");
 	bool is_AMD   = (s_vendor == "AuthenticAMD");
 
+	u32 id_max = CPU_GetID(0).EAX;
 	auto cpu_id = CPU_GetID(1);
 
 	CPU_Features cpu_features = {0};
@@ -89,12 +107,26 @@ CPU_GetFeatures() {
 		cpu_features._3dnow_ext = (cpu_id.EDX >> 30) & 0x1;
 		cpu_features._3dnow     = (cpu_id.EDX >> 31) & 0x1;
 
-		if (is_Intel) {
-			cpu_features.sse    = (cpu_id.EDX >> 25) & 0x1;
-			cpu_features.sse2   = (cpu_id.EDX >> 26) & 0x1;
-			cpu_features.sse3   = (cpu_id.ECX >>  0) & 0x1;
-			cpu_features.sse4_1 = (cpu_id.ECX >> 19) & 0x1;
-			cpu_features.sse4_2 = (cpu_id.ECX >> 20) & 0x1;
+		/// same bits for Intel and AMD
+		cpu_features.sse    = (cpu_id.EDX >> 25) & 0x1;
+		cpu_features.sse2   = (cpu_id.EDX >> 26) & 0x1;
+		cpu_features.sse3   = (cpu_id.ECX >>  0) & 0x1;
+		cpu_features.sse4_1 = (cpu_id.ECX >> 19) & 0x1;
+		cpu_features.sse4_2 = (cpu_id.ECX >> 20) & 0x1;
+
+		/// AVX also requires the os to save the ymm registers (xsave)
+		bool has_osxsave = (cpu_id.ECX >> 27) & 0x1;
+		bool has_avx     = (cpu_id.ECX >> 28) & 0x1;
+
+		if (has_osxsave AND has_avx) {
+			bool has_ymm_state = ((CPU_GetXCR(0) & 0x6) == 0x6);
+
+			cpu_features.avx = has_ymm_state;
+
+			if (has_ymm_state AND id_max >= 7) {
+				auto cpu_id_ext = CPU_GetID(7);
+				cpu_features.avx2 = (cpu_id_ext.EBX >> 5) & 0x1;
+			}
 		}
 	}
 
@@ -119,8 +151,32 @@ CPU_GetFeaturesList(
 	if (cpu_features.sse4_1)  Array_Add(a_features_out, S("SSE4.1"));
 	if (cpu_features.sse4_2)  Array_Add(a_features_out, S("SSE4.2"));
 
+	if (cpu_features.avx)     Array_Add(a_features_out, S("AVX"));
+	if (cpu_features.avx2)    Array_Add(a_features_out, S("AVX2"));
+
 	if (cpu_features._3dnow)     Array_Add(a_features_out, S("3DNow"));
 	if (cpu_features._3dnow_ext) Array_Add(a_features_out, S("3DNow Ext"));
 
 	return a_features_out;
 }
+
+
+/// selects the fastest available implementation
+/// for Memory_Copy, Memory_Set and Memory_Compare
+instant MEMORY_SIMD_TYPE
+Memory_InitSIMD(
+) {
+	CPU_Features cpu_features = CPU_GetFeatures();
+
+	MEMORY_SIMD_TYPE type = MEMORY_SIMD_NONE;
+
+	if (cpu_features.sse2)  type = MEMORY_SIMD_SSE2;
+	if (cpu_features.avx2)  type = MEMORY_SIMD_AVX2;
+
+	memory_simd = type;
+
+	return type;
+}
+
+/// runs once at startup
+inline MEMORY_SIMD_TYPE memory_simd_startup = Memory_InitSIMD();
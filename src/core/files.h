@@ -25,7 +25,24 @@ File_HasExtension(
 	if (String_IsEmpty(s_extension, true))
 		return true;
 
-	Array<String> as_extentions = Array_Split(s_extension, S("|"), DELIMITER_IGNORE, true);
+	/// references into s_extension, called for every file of a
+	/// directory listing, so a short filter needs no allocation
+	SmallArray<String, 8> as_extentions;
+
+	String s_data_it = S(s_extension);
+	s64 index_found;
+
+	while(String_Find(s_data_it, "|"_s, &index_found)) {
+		String ts_data = S(s_data_it);
+		ts_data.length = index_found;
+
+		Array_Add(as_extentions, ts_data);
+
+		String_AddOffset(s_data_it, index_found + 1);
+	}
+
+	if (!String_IsEmpty(s_data_it))
+		Array_Add(as_extentions, s_data_it);
 
     FOR_ARRAY(as_extentions, it) {
     	String ts_data = ARRAY_IT(as_extentions, it);
@@ -36,7 +53,7 @@ File_HasExtension(
 		}
     }
 
-    Array_Destroy(as_extentions);
+    Array_DestroyContainer(as_extentions);
 
 	return result;
 }
@@ -308,11 +325,11 @@ Directory_Entry_Compare (
 ) {
 	if(entry_1.type == entry_2.type) {
 		/// do not move, should always be the first entry
-		if (entry_1.s_name == "..") return -1;
-		if (entry_2.s_name == "..") return -1;
+		if (entry_1.s_name == ".."_s) return -1;
+		if (entry_2.s_name == ".."_s) return  1;
 
-		long index_1 = String_IndexOfRev(entry_1.s_name, S("."), true);
-		long index_2 = String_IndexOfRev(entry_2.s_name, S("."), true);
+		long index_1 = String_IndexOfRev(entry_1.s_name, "."_s, true);
+		long index_2 = String_IndexOfRev(entry_2.s_name, "."_s, true);
 
 		u64 length = 0;
 
@@ -0,0 +1,84 @@
+#pragma once
+
+/// f.e. for HashMap, Array_EnableIndex
+
+#define HASH_SEED 0x9E3779B97F4A7C15ull
+
+/// final mixing of all bits (murmur3)
+constexpr
+instant u64
+_Hash_Mix(
+	u64 value
+) {
+	value ^= value >> 33;
+	value *= 0xFF51AFD7ED558CCDull;
+	value ^= value >> 33;
+	value *= 0xC4CEB9FE1A85EC53ull;
+	value ^= value >> 33;
+
+	return value;
+}
+
+/// little endian, without alignment requirements
+/// (compiles to a single load)
+constexpr
+instant u64
+_Hash_Read64(
+	const char *c_data
+) {
+	u64 result = 0;
+
+	FOR(8, it) {
+		result |= (u64)(u8)c_data[it] << (it * 8);
+	}
+
+	return result;
+}
+
+/// can also be used at compile-time
+constexpr
+instant u64
+Hash_Bytes(
+	const char *c_data,
+	u64 length
+) {
+	u64 hash = HASH_SEED ^ (length * 0xC2B2AE3D27D4EB4Full);
+
+	u64 it = 0;
+
+	for(; it + 8 <= length; it += 8) {
+		hash ^= _Hash_Mix(_Hash_Read64(c_data + it));
+		hash  = ((hash << 27) | (hash >> 37)) * 5 + 0x52DCE729;
+	}
+
+	if (it < length) {
+		u64 block = 0;
+
+		for(u64 shift = 0; it < length; ++it, shift += 8)
+			block |= (u64)(u8)c_data[it] << shift;
+
+		hash ^= _Hash_Mix(block);
+	}
+
+	return _Hash_Mix(hash);
+}
+
+/// integers, enums and pointers are mixed,
+/// every other type gets hashed as bytes
+/// (String has its own overload)
+///
+/// @Important: remember checking alignment buffer
+template <typename T>
+constexpr
+instant u64
+Hash_Get(
+	const T &value
+) {
+	if constexpr (std::is_integral<T>::value OR std::is_enum<T>::value)
+		return _Hash_Mix((u64)value);
+	else
+	if constexpr (std::is_pointer<T>::value)
+		return _Hash_Mix((u64)(size_t)value);
+	else
+		return Hash_Bytes((const char *)&value, sizeof(T));
+}
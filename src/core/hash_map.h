@@ -0,0 +1,410 @@
+#pragma once
+
+/// Open addressing with robin hood probing.
+///
+/// Every slot has one metadata byte with its probe distance + 1
+/// (0 = empty), which is stored separate from the entries,
+/// so a lookup mostly stays within one cache line.
+///
+/// Removing shifts the following entries back,
+/// so there are no tombstones and the table never degrades.
+///
+/// Keys and values get copied as-is, the map does not own
+/// their memory (same as Array).
+
+/// in percent of the capacity, before the table grows
+#define HASHMAP_LOAD_FACTOR 80
+
+#define HASHMAP_CAPACITY_MIN 16
+
+/// highest probe distance a metadata byte can store,
+/// the table grows, when an entry would exceed it
+#define HASHMAP_DISTANCE_MAX 0xFF
+
+#define HASHMAP_INVALID ((u64)-1)
+
+#define FOR_HASHMAP(_map, _it) \
+	for(u64 _it = HashMap_Next(_map, 0); _it < (_map).capacity; _it = HashMap_Next(_map, _it + 1))
+
+#define HASHMAP_IT(_map, _it) \
+	((_map).entries[_it])
+
+template <typename K, typename V>
+struct HashMap_Entry {
+	K key;
+	V value;
+};
+
+template <typename K, typename V>
+struct HashMap {
+	u8                  *metadata = nullptr;
+	HashMap_Entry<K, V> *entries  = nullptr;
+
+	u64 count    = 0;
+	u64 capacity = 0;
+
+	/// if set, storage gets allocated from the arena and
+	/// old storage will be dropped with the arena
+	MemoryArena *arena = nullptr;
+};
+
+/// String keys are compared byte-wise,
+/// so they match their (case-sensitive) hash
+instant bool
+HashMap_IsEqualKey(
+	const String &s_first,
+	const String &s_second
+) {
+	return String_IsEqual(s_first, s_second);
+}
+
+template <typename T>
+instant bool
+HashMap_IsEqualKey(
+	const T &first,
+	const T &second
+) {
+	return (first == second);
+}
+
+/// returns the next used slot, starting with index_start
+template <typename K, typename V>
+instant u64
+HashMap_Next(
+	HashMap<K, V> &map,
+	u64 index_start
+) {
+	for(u64 it = index_start; it < map.capacity; ++it) {
+		if (map.metadata[it])
+			return it;
+	}
+
+	return map.capacity;
+}
+
+template <typename K, typename V>
+instant void
+_HashMap_Allocate(
+	HashMap<K, V> &map,
+	u64 capacity
+) {
+	Assert(capacity AND (capacity & (capacity - 1)) == 0);
+
+	/// metadata follows the entries in the same block,
+	/// so entries keep the alignment of the allocation
+	u64 size_entries = sizeof(HashMap_Entry<K, V>) * capacity;
+	u64 size_total   = size_entries + capacity;
+
+	char *data;
+
+	if (map.arena) {
+		data = (char *)_MemoryArena_AllocAligned(*map.arena, size_total, alignof(HashMap_Entry<K, V>));
+		Memory_Set(data, 0, size_total);
+	}
+	else {
+		data = Memory_Create(char, size_total);
+	}
+
+	map.entries  = (HashMap_Entry<K, V> *)data;
+	map.metadata = (u8 *)(data + size_entries);
+	map.capacity = capacity;
+	map.count    = 0;
+}
+
+template <typename K, typename V>
+instant void
+_HashMap_Release(
+	HashMap_Entry<K, V> *entries,
+	MemoryArena *arena
+) {
+	if (!arena AND entries)
+		Memory_Free(entries);
+}
+
+/// returns slot index of the key or HASHMAP_INVALID
+template <typename K, typename V>
+instant u64
+_HashMap_FindIndex(
+	HashMap<K, V> &map,
+	const K &key
+) {
+	if (!map.count)
+		return HASHMAP_INVALID;
+
+	u64 mask  = map.capacity - 1;
+	u64 index = Hash_Get(key) & mask;
+
+	for(u64 distance = 1; distance <= HASHMAP_DISTANCE_MAX; ++distance) {
+		u8 meta = map.metadata[index];
+
+		/// an entry closer to its home slot than the key would be,
+		/// means robin hood would have placed the key before it
+		if (meta < distance)
+			return HASHMAP_INVALID;
+
+		if (meta == distance AND HashMap_IsEqualKey(map.entries[index].key, key))
+			return index;
+
+		index = (index + 1) & mask;
+	}
+
+	return HASHMAP_INVALID;
+}
+
+template <typename K, typename V>
+instant void
+HashMap_Rehash(
+	HashMap<K, V> &map,
+	u64 capacity
+);
+
+/// expects the key to not exist
+///
+/// returns the slot index of the key or HASHMAP_INVALID,
+/// if the table had to grow, while inserting
+template <typename K, typename V>
+instant u64
+_HashMap_Insert(
+	HashMap<K, V> &map,
+	HashMap_Entry<K, V> entry
+) {
+	if ((map.count + 1) * 100 > map.capacity * HASHMAP_LOAD_FACTOR)
+		HashMap_Rehash(map, MAX(map.capacity * 2, (u64)HASHMAP_CAPACITY_MIN));
+
+	u64 result = HASHMAP_INVALID;
+	bool has_grown = false;
+
+	u64 mask  = map.capacity - 1;
+	u64 index = Hash_Get(entry.key) & mask;
+	u64 distance = 1;
+
+	while(true) {
+		u8 &meta = map.metadata[index];
+
+		if (!meta) {
+			meta = (u8)distance;
+			map.entries[index] = entry;
+			++map.count;
+
+			if (result == HASHMAP_INVALID AND !has_grown)
+				result = index;
+
+			return result;
+		}
+
+		/// take the slot from an entry, which is closer to its home
+		if (meta < distance) {
+			HashMap_Entry<K, V> t_entry = map.entries[index];
+			map.entries[index] = entry;
+			entry = t_entry;
+
+			u64 t_distance = meta;
+			meta = (u8)distance;
+			distance = t_distance;
+
+			if (result == HASHMAP_INVALID AND !has_grown)
+				result = index;
+		}
+
+		index = (index + 1) & mask;
+		++distance;
+
+		/// only with a poor hash function: every entry is still stored,
+		/// except the one being carried, so growing keeps the map valid
+		if (distance > HASHMAP_DISTANCE_MAX) {
+			if (map.count * 8 < map.capacity)
+				AssertMessage(false, "[HashMap] Probe distance exceeded, hash function does not distribute keys.");
+
+			HashMap_Rehash(map, map.capacity * 2);
+
+			has_grown = true;
+			result    = HASHMAP_INVALID;
+
+			mask     = map.capacity - 1;
+			index    = Hash_Get(entry.key) & mask;
+			distance = 1;
+		}
+	}
+}
+
+/// capacity will be rounded up to a power of 2 and fits all entries
+template <typename K, typename V>
+instant void
+HashMap_Rehash(
+	HashMap<K, V> &map,
+	u64 capacity
+) {
+	u64 capacity_min = MAX((u64)HASHMAP_CAPACITY_MIN, (map.count * 100 + HASHMAP_LOAD_FACTOR - 1) / HASHMAP_LOAD_FACTOR);
+	capacity = MAX(capacity, capacity_min);
+
+	u64 capacity_new = HASHMAP_CAPACITY_MIN;
+
+	while(capacity_new < capacity)
+		capacity_new <<= 1;
+
+	u8                  *metadata_old = map.metadata;
+	HashMap_Entry<K, V> *entries_old  = map.entries;
+	u64                  capacity_old = map.capacity;
+
+	_HashMap_Allocate(map, capacity_new);
+
+	FOR(capacity_old, it) {
+		if (metadata_old[it])
+			_HashMap_Insert(map, entries_old[it]);
+	}
+
+	_HashMap_Release(entries_old, map.arena);
+}
+
+/// grows the table (once), so count entries can be added without rehashing
+template <typename K, typename V>
+instant void
+HashMap_Reserve(
+	HashMap<K, V> &map,
+	u64 count
+) {
+	if (count * 100 <= map.capacity * HASHMAP_LOAD_FACTOR)
+		return;
+
+	HashMap_Rehash(map, (count * 100 + HASHMAP_LOAD_FACTOR - 1) / HASHMAP_LOAD_FACTOR);
+}
+
+/// returns nullptr, if the key does not exist
+template <typename K, typename V>
+instant V *
+HashMap_Find(
+	HashMap<K, V> &map,
+	const K &key
+) {
+	u64 index = _HashMap_FindIndex(map, key);
+
+	if (index == HASHMAP_INVALID)
+		return nullptr;
+
+	return &map.entries[index].value;
+}
+
+template <typename K, typename V>
+instant bool
+HashMap_Get(
+	HashMap<K, V> &map,
+	const K &key,
+	V *value_out
+) {
+	V *t_value = HashMap_Find(map, key);
+
+	if (!t_value)
+		return false;
+
+	if (value_out)
+		*value_out = *t_value;
+
+	return true;
+}
+
+/// returns true, if the key did already exist,
+/// a new value will be empty initialized
+template <typename K, typename V>
+instant bool
+HashMap_FindOrAdd(
+	HashMap<K, V> &map,
+	const K &key,
+	V **value_out
+) {
+	Assert(value_out);
+
+	u64 index = _HashMap_FindIndex(map, key);
+
+	if (index != HASHMAP_INVALID) {
+		*value_out = &map.entries[index].value;
+		return true;
+	}
+
+	index = _HashMap_Insert(map, {key, {}});
+
+	if (index == HASHMAP_INVALID)
+		index = _HashMap_FindIndex(map, key);
+
+	*value_out = &map.entries[index].value;
+
+	return false;
+}
+
+/// adds or overwrites the value of the key
+template <typename K, typename V>
+instant V *
+HashMap_Set(
+	HashMap<K, V> &map,
+	const K &key,
+	const V &value
+) {
+	V *t_value;
+	HashMap_FindOrAdd(map, key, &t_value);
+
+	*t_value = value;
+
+	return t_value;
+}
+
+/// returns false, if the key does not exist
+template <typename K, typename V>
+instant bool
+HashMap_Remove(
+	HashMap<K, V> &map,
+	const K &key
+) {
+	u64 index = _HashMap_FindIndex(map, key);
+
+	if (index == HASHMAP_INVALID)
+		return false;
+
+	u64 mask = map.capacity - 1;
+
+	/// shift following entries back, until one is
+	/// at its home slot or the slot is empty
+	while(true) {
+		u64 index_next = (index + 1) & mask;
+		u8  meta_next  = map.metadata[index_next];
+
+		if (meta_next <= 1) {
+			map.metadata[index] = 0;
+			map.entries[index]  = {};
+			break;
+		}
+
+		map.metadata[index] = meta_next - 1;
+		map.entries[index]  = map.entries[index_next];
+
+		index = index_next;
+	}
+
+	--map.count;
+
+	return true;
+}
+
+/// keeps the capacity
+template <typename K, typename V>
+instant void
+HashMap_Clear(
+	HashMap<K, V> &map
+) {
+	if (!map.capacity)
+		return;
+
+	Memory_Set(map.metadata, 0, map.capacity);
+	map.count = 0;
+}
+
+template <typename K, typename V>
+instant void
+HashMap_Destroy(
+	HashMap<K, V> &map
+) {
+	_HashMap_Release(map.entries, map.arena);
+
+	map.metadata = nullptr;
+	map.entries  = nullptr;
+	map.count    = 0;
+	map.capacity = 0;
+}
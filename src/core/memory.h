@@ -10,20 +10,283 @@
 
 #define MEMORY_SIGNATURE 123456
 
+/// MemoryPool slots (memory_pool.h)
+#define MEMORY_SIGNATURE_POOL		234567
+#define MEMORY_SIGNATURE_POOL_FREE	345678
+
 struct Memory_Header {
+#if MEMORY_TRACKING
+	Memory_Header *prev;
+	Memory_Header *next;
+	u64 size;
+	const char *file;
+	const char *tag;
+	u32 line;
+#endif
+	/// has to stay the last member, since it is used
+	/// to identify the memory right in front of the data
 	u32 sig;
 };
 
-constexpr
+/// memory_pool.h
+instant void _MemoryPool_FreeSlot(void *data);
+instant u64  _MemoryPool_GetSlotSize(void *data);
+
+/// ::: Tracking
+/// ===========================================================================
+#if MEMORY_TRACKING
+
+/// amount of different tags with their own statistics
+#define MEMORY_TRACKING_TAG_COUNT 64
+
+/// adds a tag to every allocation until the end of the current scope
+#define MEMORY_TAG(_tag) \
+	Memory_TagScope _memory_tag_scope(_tag)
+
+struct Memory_Stats {
+	const char *tag = nullptr;
+
+	u64 bytes_live    = 0;
+	u64 bytes_peak    = 0;
+	u64 count_live    = 0;
+	u64 count_alloc   = 0;
+	u64 count_realloc = 0;
+};
+
+struct Memory_Tracking {
+	/// list of live allocations
+	Memory_Header *first = nullptr;
+
+	Memory_Stats total;
+	Memory_Stats tags[MEMORY_TRACKING_TAG_COUNT];
+	u64 tag_count = 0;
+
+	volatile long lock = 0;
+};
+
+inline Memory_Tracking memory_tracking;
+inline thread_local const char *memory_tag = nullptr;
+
+/// returns the previous tag
+instant const char *
+Memory_SetTag(
+	const char *tag
+) {
+	const char *tag_prev = memory_tag;
+	memory_tag = tag;
+
+	return tag_prev;
+}
+
+struct Memory_TagScope {
+	const char *tag_prev = nullptr;
+
+	Memory_TagScope(const char *tag)  { tag_prev = Memory_SetTag(tag); }
+	~Memory_TagScope()                { Memory_SetTag(tag_prev); }
+};
+
+instant void
+_Memory_TrackingLock(
+) {
+	while(InterlockedExchange(&memory_tracking.lock, 1))
+		Sleep(0);
+}
+
+instant void
+_Memory_TrackingUnlock(
+) {
+	InterlockedExchange(&memory_tracking.lock, 0);
+}
+
+/// tracking has to be locked
+instant Memory_Stats *
+_Memory_GetTagStats(
+	const char *tag
+) {
+	if (!tag)
+		tag = "untagged";
+
+	FOR(memory_tracking.tag_count, it) {
+		Memory_Stats *t_stats = &memory_tracking.tags[it];
+
+		if (t_stats->tag == tag OR strcmp(t_stats->tag, tag) == 0)
+			return t_stats;
+	}
+
+	if (memory_tracking.tag_count >= MEMORY_TRACKING_TAG_COUNT)
+		return nullptr;
+
+	Memory_Stats *t_stats = &memory_tracking.tags[memory_tracking.tag_count++];
+	t_stats->tag = tag;
+
+	return t_stats;
+}
+
+instant void
+_Memory_StatsAdd(
+	Memory_Stats *stats_io,
+	u64 size,
+	bool is_realloc
+) {
+	if (!stats_io)
+		return;
+
+	stats_io->bytes_live += size;
+	stats_io->bytes_peak  = MAX(stats_io->bytes_peak, stats_io->bytes_live);
+	stats_io->count_live += 1;
+
+	if (is_realloc)
+		stats_io->count_realloc += 1;
+	else
+		stats_io->count_alloc   += 1;
+}
+
+instant void
+_Memory_StatsRemove(
+	Memory_Stats *stats_io,
+	u64 size
+) {
+	if (!stats_io)
+		return;
+
+	stats_io->bytes_live -= size;
+	stats_io->count_live -= 1;
+}
+
+/// reallocated memory keeps its tag
+instant void
+_Memory_Track(
+	Memory_Header *header,
+	u64 size,
+	const char *file,
+	u32 line,
+	bool is_realloc
+) {
+	header->size = size;
+	header->file = file;
+	header->line = line;
+	header->prev = nullptr;
+
+	if (!is_realloc)
+		header->tag = memory_tag;
+
+	_Memory_TrackingLock();
+
+	header->next = memory_tracking.first;
+
+	if (memory_tracking.first)
+		memory_tracking.first->prev = header;
+
+	memory_tracking.first = header;
+
+	_Memory_StatsAdd(&memory_tracking.total, size, is_realloc);
+	_Memory_StatsAdd(_Memory_GetTagStats(header->tag), size, is_realloc);
+
+	_Memory_TrackingUnlock();
+}
+
+instant void
+_Memory_Untrack(
+	Memory_Header *header
+) {
+	_Memory_TrackingLock();
+
+	if (header->prev)
+		header->prev->next = header->next;
+	else
+		memory_tracking.first = header->next;
+
+	if (header->next)
+		header->next->prev = header->prev;
+
+	_Memory_StatsRemove(&memory_tracking.total, header->size);
+	_Memory_StatsRemove(_Memory_GetTagStats(header->tag), header->size);
+
+	_Memory_TrackingUnlock();
+}
+
+instant Memory_Stats
+Memory_GetStats(
+) {
+	_Memory_TrackingLock();
+	Memory_Stats stats = memory_tracking.total;
+	_Memory_TrackingUnlock();
+
+	return stats;
+}
+
+instant void
+_Memory_PrintStats(
+	const Memory_Stats &stats
+) {
+	std::cout
+		<< stats.tag << ": "
+		<< stats.bytes_live    << " bytes live, "
+		<< stats.bytes_peak    << " bytes peak, "
+		<< stats.count_live    << " live, "
+		<< stats.count_alloc   << " allocs, "
+		<< stats.count_realloc << " reallocs"
+		<< std::endl;
+}
+
+instant void
+Memory_PrintStats(
+) {
+	_Memory_TrackingLock();
+
+	Memory_Stats stats = memory_tracking.total;
+	stats.tag = "[Memory] total";
+	_Memory_PrintStats(stats);
+
+	FOR(memory_tracking.tag_count, it) {
+		_Memory_PrintStats(memory_tracking.tags[it]);
+	}
+
+	_Memory_TrackingUnlock();
+}
+
+instant void
+Memory_PrintLeaks(
+) {
+	_Memory_TrackingLock();
+
+	for(Memory_Header *it = memory_tracking.first; it; it = it->next) {
+		std::cout
+			<< "[Memory] leak: "
+			<< it->size << " bytes "
+			<< "(" << (it->tag ? it->tag : "untagged") << ") "
+			<< it->file << ":" << it->line
+			<< std::endl;
+	}
+
+	_Memory_TrackingUnlock();
+}
+
+/// dump leaks, when the application ends
+inline bool memory_tracking_startup = (atexit(Memory_PrintLeaks), true);
+
+#else
+
+#define MEMORY_TAG(_tag)
+
+#endif // MEMORY_TRACKING
+
+/// file / line: call site for MEMORY_TRACKING
 instant void *
 _Memory_Alloc_Empty(
-	u64 size
+	u64 size,
+	[[maybe_unused]] const char *file = __builtin_FILE(),
+	[[maybe_unused]] u32 line = __builtin_LINE()
 ) {
     void *mem = calloc(1, size + sizeof(Memory_Header));
 
     AssertMessage(mem, "Memory could not be allocated.");
 
     ((Memory_Header *)mem)->sig = MEMORY_SIGNATURE;
+
+#if MEMORY_TRACKING
+	_Memory_Track((Memory_Header *)mem, size, file, line, false);
+#endif
     mem = (char *)mem + sizeof(Memory_Header);
 
     return mem;
@@ -63,10 +326,19 @@ _Memory_Free(
 
 	if (mem_header.sig == MEMORY_SIGNATURE) {
 		void *mem = (char *)data - sizeof(Memory_Header);
+
+#if MEMORY_TRACKING
+		_Memory_Untrack((Memory_Header *)mem);
+#endif
+
 		free(mem);
 
 		Assert(mem != data);
 	}
+	else
+	if (mem_header.sig == MEMORY_SIGNATURE_POOL) {
+		_MemoryPool_FreeSlot((void *)data);
+	}
 	else {
 		LOG_WARNING("Trying to free heap pointer(?).")
 	}
@@ -74,20 +346,25 @@ _Memory_Free(
 	return 0;
 }
 
+/// implementation used by Memory_Copy, Memory_Set and Memory_Compare
+enum MEMORY_SIMD_TYPE {
+	MEMORY_SIMD_NONE,
+	MEMORY_SIMD_SSE2,
+	MEMORY_SIMD_AVX2
+};
+
+/// selected at startup by Memory_InitSIMD (cpu.h),
+/// the scalar version is used until then
+inline MEMORY_SIMD_TYPE memory_simd = MEMORY_SIMD_NONE;
+
 constexpr
 instant void
-Memory_Copy(
-	const void *dest_out,
-	const void *src,
+_Memory_CopyScalar(
+	char *c_dest,
+	const char *c_src,
 	u64 length
 ) {
-	if (!dest_out OR !src OR !length)	return;
-	if (dest_out == src)				return;
-
-    char *c_dest = (char *)dest_out;
-    char *c_src  = (char *)src;
-
-    if (dest_out > src) {
+    if (c_dest > c_src) {
 		while(length-- > 0)
 			c_dest[length] = c_src[length];
     }
@@ -98,25 +375,153 @@ Memory_Copy(
     }
 }
 
+__attribute__((target("sse2")))
+instant void
+_Memory_CopySSE2(
+	char *c_dest,
+	const char *c_src,
+	u64 length
+) {
+	constexpr u64 block = sizeof(__m128i);
+
+	/// overlapping with the destination behind the source:
+	/// copy backwards, so the source is read before it gets overwritten
+	if (c_dest > c_src AND c_dest < c_src + length) {
+		while(length >= block) {
+			length -= block;
+			__m128i data = _mm_loadu_si128((const __m128i *)(c_src + length));
+			_mm_storeu_si128((__m128i *)(c_dest + length), data);
+		}
 
+		while(length-- > 0)
+			c_dest[length] = c_src[length];
+
+		return;
+	}
+
+	u64 it = 0;
+
+	for(; it + block <= length; it += block) {
+		__m128i data = _mm_loadu_si128((const __m128i *)(c_src + it));
+		_mm_storeu_si128((__m128i *)(c_dest + it), data);
+	}
+
+	for(; it < length; ++it)
+		c_dest[it] = c_src[it];
+}
+
+__attribute__((target("avx2")))
+instant void
+_Memory_CopyAVX2(
+	char *c_dest,
+	const char *c_src,
+	u64 length
+) {
+	constexpr u64 block = sizeof(__m256i);
+
+	/// overlapping with the destination behind the source:
+	/// copy backwards, so the source is read before it gets overwritten
+	if (c_dest > c_src AND c_dest < c_src + length) {
+		while(length >= block) {
+			length -= block;
+			__m256i data = _mm256_loadu_si256((const __m256i *)(c_src + length));
+			_mm256_storeu_si256((__m256i *)(c_dest + length), data);
+		}
+
+		while(length-- > 0)
+			c_dest[length] = c_src[length];
+
+		return;
+	}
+
+	u64 it = 0;
+
+	for(; it + block * 4 <= length; it += block * 4) {
+		__m256i data_1 = _mm256_loadu_si256((const __m256i *)(c_src + it) + 0);
+		__m256i data_2 = _mm256_loadu_si256((const __m256i *)(c_src + it) + 1);
+		__m256i data_3 = _mm256_loadu_si256((const __m256i *)(c_src + it) + 2);
+		__m256i data_4 = _mm256_loadu_si256((const __m256i *)(c_src + it) + 3);
+
+		_mm256_storeu_si256((__m256i *)(c_dest + it) + 0, data_1);
+		_mm256_storeu_si256((__m256i *)(c_dest + it) + 1, data_2);
+		_mm256_storeu_si256((__m256i *)(c_dest + it) + 2, data_3);
+		_mm256_storeu_si256((__m256i *)(c_dest + it) + 3, data_4);
+	}
+
+	for(; it + block <= length; it += block) {
+		__m256i data = _mm256_loadu_si256((const __m256i *)(c_src + it));
+		_mm256_storeu_si256((__m256i *)(c_dest + it), data);
+	}
+
+	for(; it < length; ++it)
+		c_dest[it] = c_src[it];
+}
+
+/// does support overlapping memory
+constexpr
+instant void
+Memory_Copy(
+	const void *dest_out,
+	const void *src,
+	u64 length
+) {
+	if (!dest_out OR !src OR !length)	return;
+	if (dest_out == src)				return;
+
+    char *c_dest = (char *)dest_out;
+    char *c_src  = (char *)src;
+
+	switch (memory_simd) {
+		case MEMORY_SIMD_AVX2: {
+			_Memory_CopyAVX2(c_dest, c_src, length);
+		} break;
+
+		case MEMORY_SIMD_SSE2: {
+			_Memory_CopySSE2(c_dest, c_src, length);
+		} break;
+
+		default: {
+			_Memory_CopyScalar(c_dest, c_src, length);
+		} break;
+	}
+}
+
+/// file / line: call site for MEMORY_TRACKING
 instant void *
 _Memory_Resize(
 	void *mem,
-	u64 size
+	u64 size,
+	const char *file = __builtin_FILE(),
+	u32 line = __builtin_LINE()
 ) {
 	if (!mem)
-		return _Memory_Alloc_Empty(size);
+		return _Memory_Alloc_Empty(size, file, line);
 
 	Memory_Header mem_header;
 	Memory_GetHeader(&mem_header, mem);
 
+	/// pool slots have a fixed size -> continue on the heap
+	if (mem_header.sig == MEMORY_SIGNATURE_POOL) {
+		void *mem_new = _Memory_Alloc_Empty(size, file, line);
+
+		Memory_Copy(mem_new, mem, MIN(size, _MemoryPool_GetSlotSize(mem)));
+		_MemoryPool_FreeSlot(mem);
+
+		return mem_new;
+	}
+
 	if (mem_header.sig != MEMORY_SIGNATURE)
-		return _Memory_Alloc_Empty(size);
+		return _Memory_Alloc_Empty(size, file, line);
 
 	mem = (char *)mem - sizeof(Memory_Header);
 
 	void *mem_old = mem;
 
+#if MEMORY_TRACKING
+	/// the header might move
+	_Memory_Untrack((Memory_Header *)mem);
+#endif
+
 	///@Info: - will NOT keep the same (virtual) memory address!!!
 	///       - does NOT init to 0 (zero)
 	///       - will also once in a blue moon return 0 when there
@@ -130,11 +535,73 @@ _Memory_Resize(
 
 	((Memory_Header *)mem)->sig = MEMORY_SIGNATURE;
 
+#if MEMORY_TRACKING
+	_Memory_Track((Memory_Header *)mem, size, file, line, true);
+#endif
+
 	mem = (char *)mem + sizeof(Memory_Header);
 
 	return mem;
 }
 
+constexpr
+instant void
+_Memory_SetScalar(
+	u8 *c_dest,
+	u8  c_data,
+	u64 length
+) {
+	while (length-- > 0)
+		*c_dest++ = c_data;
+}
+
+__attribute__((target("sse2")))
+instant void
+_Memory_SetSSE2(
+	u8 *c_dest,
+	u8  c_data,
+	u64 length
+) {
+	constexpr u64 block = sizeof(__m128i);
+
+	__m128i data = _mm_set1_epi8(c_data);
+
+	u64 it = 0;
+
+	for(; it + block <= length; it += block)
+		_mm_storeu_si128((__m128i *)(c_dest + it), data);
+
+	for(; it < length; ++it)
+		c_dest[it] = c_data;
+}
+
+__attribute__((target("avx2")))
+instant void
+_Memory_SetAVX2(
+	u8 *c_dest,
+	u8  c_data,
+	u64 length
+) {
+	constexpr u64 block = sizeof(__m256i);
+
+	__m256i data = _mm256_set1_epi8(c_data);
+
+	u64 it = 0;
+
+	for(; it + block * 4 <= length; it += block * 4) {
+		_mm256_storeu_si256((__m256i *)(c_dest + it) + 0, data);
+		_mm256_storeu_si256((__m256i *)(c_dest + it) + 1, data);
+		_mm256_storeu_si256((__m256i *)(c_dest + it) + 2, data);
+		_mm256_storeu_si256((__m256i *)(c_dest + it) + 3, data);
+	}
+
+	for(; it + block <= length; it += block)
+		_mm256_storeu_si256((__m256i *)(c_dest + it), data);
+
+	for(; it < length; ++it)
+		c_dest[it] = c_data;
+}
+
 constexpr
 instant void
 Memory_Set(
@@ -148,10 +615,78 @@ Memory_Set(
 	u8 *c_dest = (u8*)dest_out;
 	u8  c_data = data;
 
-	while (length-- > 0)
-		*c_dest++ = c_data;
+	switch (memory_simd) {
+		case MEMORY_SIMD_AVX2: {
+			_Memory_SetAVX2(c_dest, c_data, length);
+		} break;
+
+		case MEMORY_SIMD_SSE2: {
+			_Memory_SetSSE2(c_dest, c_data, length);
+		} break;
+
+		default: {
+			_Memory_SetScalar(c_dest, c_data, length);
+		} break;
+	}
+}
+
+instant bool
+_Memory_CompareScalar(
+	const char *c_data_1,
+	const char *c_data_2,
+	u64 length
+) {
+	FOR(length, it) {
+		if (c_data_1[it] != c_data_2[it])
+			return false;
+	}
+
+	return true;
 }
 
+__attribute__((target("sse2")))
+instant bool
+_Memory_CompareSSE2(
+	const char *c_data_1,
+	const char *c_data_2,
+	u64 length
+) {
+	constexpr u64 block = sizeof(__m128i);
+
+	u64 it = 0;
+
+	for(; it + block <= length; it += block) {
+		__m128i data_1 = _mm_loadu_si128((const __m128i *)(c_data_1 + it));
+		__m128i data_2 = _mm_loadu_si128((const __m128i *)(c_data_2 + it));
+
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(data_1, data_2)) != 0xFFFF)
+			return false;
+	}
+
+	return _Memory_CompareScalar(c_data_1 + it, c_data_2 + it, length - it);
+}
+
+__attribute__((target("avx2")))
+instant bool
+_Memory_CompareAVX2(
+	const char *c_data_1,
+	const char *c_data_2,
+	u64 length
+) {
+	constexpr u64 block = sizeof(__m256i);
+
+	u64 it = 0;
+
+	for(; it + block <= length; it += block) {
+		__m256i data_1 = _mm256_loadu_si256((const __m256i *)(c_data_1 + it));
+		__m256i data_2 = _mm256_loadu_si256((const __m256i *)(c_data_2 + it));
+
+		if ((u32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(data_1, data_2)) != 0xFFFFFFFF)
+			return false;
+	}
+
+	return _Memory_CompareScalar(c_data_1 + it, c_data_2 + it, length - it);
+}
 
 /// @Inmportant: remember checking alignment buffer
 ///
@@ -162,12 +697,16 @@ Memory_Compare(
 	void *data_2,
 	u64   length
 ) {
-	FOR(length, it) {
-		if (((char *)data_1)[it] != ((char *)data_2)[it])
-			return false;
-	}
+	switch (memory_simd) {
+		case MEMORY_SIMD_AVX2:
+			return _Memory_CompareAVX2((char *)data_1, (char *)data_2, length);
 
-	return true;
+		case MEMORY_SIMD_SSE2:
+			return _Memory_CompareSSE2((char *)data_1, (char *)data_2, length);
+
+		default:
+			return _Memory_CompareScalar((char *)data_1, (char *)data_2, length);
+	}
 }
 
 /// to bytes
@@ -176,8 +715,8 @@ constexpr u64 Kilobyte(u64 value) {
 }
 
 constexpr u64 Megabyte(u64 value) {
-    return Kilobyte(1) * 1024;
+    return Kilobyte(value) * 1024;
 }
 constexpr u64 Gigabyte(u64 value) {
-    return Megabyte(1) * 1024;
+    return Megabyte(value) * 1024;
 }
@@ -1,10 +1,45 @@
 #pragma once
 
+/// virtual memory gets committed in steps of this size
+#define MEMORY_ARENA_COMMIT_SIZE 		Kilobyte(64)
+
+/// never decommit memory on MemoryArena_Clear
+#define MEMORY_ARENA_KEEP_COMMITTED 	((u64)-1)
+
+/// used by _MemoryArena_Alloc
+#define MEMORY_ARENA_ALIGNMENT_DEFAULT	8
+
 struct MemoryArena {
     void *pool = nullptr;
     u64 size = 0;
     u64 pos = 0;
     const char *debug_name = nullptr;
+
+    /// virtual memory: the address space of "size" is reserved,
+    /// but only "committed" bytes are backed by physical memory
+    u64 committed = 0;
+    u64 decommit_above = MEMORY_ARENA_KEEP_COMMITTED;
+
+    /// amount of blocks added, after the first block was full
+    u64 chain_count = 0;
+
+    bool is_virtual = false;
+};
+
+/// stored at the beginning of every chained block,
+/// to restore the previous block when it gets released
+struct MemoryArena_Chain {
+    void *pool = nullptr;
+    u64 size = 0;
+    u64 pos = 0;
+    u64 committed = 0;
+};
+
+/// position to return to with MemoryArena_Rewind
+struct MemoryArena_Marker {
+    void *pool = nullptr;
+    u64 pos = 0;
+    u64 chain_count = 0;
 };
 
 instant MemoryArena
@@ -21,44 +56,256 @@ MemoryArena_Create(
     return arena;
 }
 
+/// Reserves the address space only and commits memory
+/// on demand, while allocating.
+///
+/// decommit_above: MemoryArena_Clear will release committed
+///                 memory above this size
+instant MemoryArena
+MemoryArena_CreateVirtual(
+    u64 size,
+    const char *name = "",
+    u64 decommit_above = MEMORY_ARENA_KEEP_COMMITTED
+) {
+    MemoryArena arena;
+
+    arena.size = size;
+    arena.pool = VirtualAlloc(0, arena.size, MEM_RESERVE, PAGE_READWRITE);
+    arena.debug_name = name;
+    arena.is_virtual = true;
+    arena.decommit_above = decommit_above;
+
+    AssertMessage(arena.pool, "Memory (virtual) could not be reserved.");
+
+    return arena;
+}
+
 constexpr
-instant void *
-_MemoryArena_Alloc (
-    MemoryArena &arena,
+instant u64
+_MemoryArena_GetCommitSize(
     u64 size
 ) {
-    if (size > arena.size - arena.pos) {
-        VALUE(arena.size)
-        VALUE(arena.debug_name)
-        AssertMessage(false, "Memory (temp) could not be allocated");
+    return ((size + MEMORY_ARENA_COMMIT_SIZE - 1) / MEMORY_ARENA_COMMIT_SIZE)
+           * MEMORY_ARENA_COMMIT_SIZE;
+}
+
+/// makes sure memory is committed up to "pos_end"
+instant bool
+_MemoryArena_Commit(
+    MemoryArena &arena,
+    u64 pos_end
+) {
+    if (pos_end <= arena.committed)
+        return true;
+
+    u64 commit_end = MIN(_MemoryArena_GetCommitSize(pos_end), arena.size);
+
+    void *mem = VirtualAlloc((char *)arena.pool + arena.committed,
+                             commit_end - arena.committed,
+                             MEM_COMMIT,
+                             PAGE_READWRITE);
+
+    if (!mem)
+        return false;
+
+    arena.committed = commit_end;
+
+    return true;
+}
+
+/// releases the current block only
+instant void
+_MemoryArena_Release(
+    MemoryArena &arena
+) {
+    if (!arena.pool)
+        return;
+
+    if (arena.is_virtual)
+        VirtualFree(arena.pool, 0, MEM_RELEASE);
+    else
+        Memory_Free(arena.pool);
+
+    arena.pool = nullptr;
+}
+
+/// continues with a new block, when the current one is full
+instant bool
+_MemoryArena_Chain(
+    MemoryArena &arena,
+    u64 size_min
+) {
+    MemoryArena_Chain chain;
+    chain.pool      = arena.pool;
+    chain.size      = arena.size;
+    chain.pos       = arena.pos;
+    chain.committed = arena.committed;
+
+    u64 block_size = MAX(arena.size, size_min + sizeof(MemoryArena_Chain));
+
+    void *pool = nullptr;
+
+    if (arena.is_virtual)
+        pool = VirtualAlloc(0, block_size, MEM_RESERVE, PAGE_READWRITE);
+    else
+        pool = _Memory_Alloc_Empty(block_size);
+
+    if (!pool)
+        return false;
+
+    arena.pool      = pool;
+    arena.size      = block_size;
+    arena.pos       = 0;
+    arena.committed = 0;
+
+    if (arena.is_virtual AND !_MemoryArena_Commit(arena, sizeof(MemoryArena_Chain))) {
+        _MemoryArena_Release(arena);
+
+        arena.pool      = chain.pool;
+        arena.size      = chain.size;
+        arena.pos       = chain.pos;
+        arena.committed = chain.committed;
+
+        return false;
     }
 
+    *(MemoryArena_Chain *)arena.pool = chain;
+    arena.pos = sizeof(MemoryArena_Chain);
+
+    ++arena.chain_count;
+
+    LOG_INFO("Memory arena \"" << arena.debug_name << "\" continues with a new block.");
+
+    return true;
+}
+
+/// releases the current chained block and continues with the previous one
+instant void
+_MemoryArena_Unchain(
+    MemoryArena &arena
+) {
+    Assert(arena.chain_count);
+
+    MemoryArena_Chain chain = *(MemoryArena_Chain *)arena.pool;
+
+    _MemoryArena_Release(arena);
+
+    arena.pool      = chain.pool;
+    arena.size      = chain.size;
+    arena.pos       = chain.pos;
+    arena.committed = chain.committed;
+
+    --arena.chain_count;
+}
+
+/// alignment: has to be a power of 2
+instant void *
+_MemoryArena_AllocAligned(
+    MemoryArena &arena,
+    u64 size,
+    u64 alignment
+) {
+    Assert(alignment AND (alignment & (alignment - 1)) == 0);
+
     if (!arena.pool) {
         AssertMessage(false, "Memory (temp) not initialized.");
+        return nullptr;
+    }
+
+    size_t address = (size_t)arena.pool + arena.pos;
+    u64 padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+
+    if (size + padding > arena.size - arena.pos) {
+        if (!_MemoryArena_Chain(arena, size + alignment)) {
+            VALUE(arena.size)
+            VALUE(arena.debug_name)
+            AssertMessage(false, "Memory (temp) could not be allocated");
+            return nullptr;
+        }
+
+        address = (size_t)arena.pool + arena.pos;
+        padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+    }
+
+    if (arena.is_virtual AND !_MemoryArena_Commit(arena, arena.pos + padding + size)) {
+        AssertMessage(false, "Memory (virtual) could not be committed.");
+        return nullptr;
     }
 
-    void *mem = arena.pool;
+    /// keep the pool as base pointer, so it can still be free'd
+    void *mem = (char *)arena.pool + arena.pos + padding;
 
-    arena.pool = (char *)arena.pool + size;
-    arena.pos  += size;
+    arena.pos += padding + size;
 
     return mem;
 }
 
-constexpr
+instant void *
+_MemoryArena_Alloc (
+    MemoryArena &arena,
+    u64 size
+) {
+    return _MemoryArena_AllocAligned(arena, size, MEMORY_ARENA_ALIGNMENT_DEFAULT);
+}
+
+instant MemoryArena_Marker
+MemoryArena_Mark(
+    MemoryArena &arena
+) {
+    MemoryArena_Marker marker;
+    marker.pool        = arena.pool;
+    marker.pos         = arena.pos;
+    marker.chain_count = arena.chain_count;
+
+    return marker;
+}
+
+/// releases everything allocated after the marker was set
+instant void
+MemoryArena_Rewind(
+    MemoryArena &arena,
+    const MemoryArena_Marker &marker
+) {
+    while(arena.chain_count > marker.chain_count)
+        _MemoryArena_Unchain(arena);
+
+    AssertMessage(arena.pool == marker.pool, "Memory arena marker does not belong to this arena.");
+    Assert(marker.pos <= arena.pos);
+
+    arena.pos = marker.pos;
+}
+
 instant void
 MemoryArena_Clear(
     MemoryArena &arena
 ) {
+    while(arena.chain_count)
+        _MemoryArena_Unchain(arena);
+
     arena.pos = 0;
+
+    if (!arena.is_virtual OR arena.committed <= arena.decommit_above)
+        return;
+
+    u64 keep = _MemoryArena_GetCommitSize(arena.decommit_above);
+
+    if (keep >= arena.committed)
+        return;
+
+    VirtualFree((char *)arena.pool + keep,
+                arena.committed - keep,
+                MEM_DECOMMIT);
+
+    arena.committed = keep;
 }
 
-constexpr
 instant void
 MemoryArena_Free(
     MemoryArena &arena
 ) {
     MemoryArena_Clear(arena);
+    _MemoryArena_Release(arena);
+
     arena.size = 0;
-    Memory_Free(arena.pool);
+    arena.committed = 0;
 }
@@ -0,0 +1,350 @@
+#pragma once
+
+/// slots per slab, if not set on creation
+#define MEMORY_POOL_SLAB_COUNT_DEFAULT	64
+
+/// slots a thread keeps, before returning them to the pool
+#define MEMORY_POOL_CACHE_SIZE			32
+
+/// amount of pools a thread can cache slots for at the same time
+#define MEMORY_POOL_CACHE_COUNT			8
+
+/// space in front of every slot, which stores the owning pool and
+/// ends with the Memory_Header, so Memory_Free can identify it
+#define MEMORY_POOL_HEADER_SIZE \
+	(((sizeof(void *) + sizeof(Memory_Header) + 15) / 16) * 16)
+
+/// Type independent part of MemoryPool<T>,
+/// so slots can be returned by Memory_Free.
+///
+/// Free slots and slabs are linked (intrusive),
+/// using the first bytes of their memory.
+struct MemoryPool_Data {
+	u64   slot_size  = 0;
+	u64   slab_count = 0;
+
+	void *free_list  = nullptr;
+	void *slabs      = nullptr;
+
+	u64   count_slabs = 0;
+
+	volatile long count_used = 0;
+	volatile long lock = 0;
+
+	/// pool will be shared between threads: the free list gets
+	/// locked and every thread keeps a few slots for itself
+	bool  use_thread_cache = false;
+};
+
+template <typename T>
+struct MemoryPool {
+	MemoryPool_Data data;
+};
+
+struct MemoryPool_Cache {
+	MemoryPool_Data *pool = nullptr;
+	u64   count = 0;
+	void *slots[MEMORY_POOL_CACHE_SIZE] = {};
+};
+
+inline thread_local MemoryPool_Cache memory_pool_caches[MEMORY_POOL_CACHE_COUNT];
+
+/// returns the cached slots of a thread to their pools, when it ends
+struct MemoryPool_ThreadExit {
+	bool is_active = false;
+
+	~MemoryPool_ThreadExit();
+};
+
+inline thread_local MemoryPool_ThreadExit memory_pool_thread_exit;
+
+/// @Important: do not copy the pool, after allocating from it,
+///             since every slot points back to it
+template <typename T>
+instant MemoryPool<T>
+MemoryPool_Create(
+	u64 slab_count = MEMORY_POOL_SLAB_COUNT_DEFAULT,
+	bool use_thread_cache = false
+) {
+	Assert(slab_count > 0);
+
+	MemoryPool<T> pool;
+
+	/// a free slot has to be able to store the next free slot
+	u64 size = MAX(sizeof(T), sizeof(void *));
+
+	pool.data.slot_size  = ((size + MEMORY_POOL_HEADER_SIZE - 1) / MEMORY_POOL_HEADER_SIZE)
+						   * MEMORY_POOL_HEADER_SIZE;
+	pool.data.slab_count = slab_count;
+	pool.data.use_thread_cache = use_thread_cache;
+
+	return pool;
+}
+
+instant void
+_MemoryPool_Lock(
+	MemoryPool_Data &pool
+) {
+	if (!pool.use_thread_cache)
+		return;
+
+	while(InterlockedExchange(&pool.lock, 1))
+		Sleep(0);
+}
+
+instant void
+_MemoryPool_Unlock(
+	MemoryPool_Data &pool
+) {
+	if (!pool.use_thread_cache)
+		return;
+
+	InterlockedExchange(&pool.lock, 0);
+}
+
+/// pool has to be locked
+instant void
+_MemoryPool_AddSlab(
+	MemoryPool_Data &pool
+) {
+	u64 stride = MEMORY_POOL_HEADER_SIZE + pool.slot_size;
+
+	char *slab = (char *)_Memory_Alloc_Empty(MEMORY_POOL_HEADER_SIZE + stride * pool.slab_count);
+
+	*(void **)slab = pool.slabs;
+	pool.slabs = slab;
+	++pool.count_slabs;
+
+	/// link in reverse, so the first slot will be used first
+	for(s64 it = pool.slab_count - 1; it >= 0; --it) {
+		char *slot = slab + MEMORY_POOL_HEADER_SIZE + stride * it;
+		void *data = slot + MEMORY_POOL_HEADER_SIZE;
+
+		*(MemoryPool_Data **)slot = &pool;
+		*(void **)data = pool.free_list;
+
+		pool.free_list = data;
+	}
+}
+
+/// pool has to be locked
+instant void *
+_MemoryPool_Pop(
+	MemoryPool_Data &pool
+) {
+	if (!pool.free_list)
+		_MemoryPool_AddSlab(pool);
+
+	void *data = pool.free_list;
+	pool.free_list = *(void **)data;
+
+	return data;
+}
+
+/// pool has to be locked
+instant void
+_MemoryPool_Push(
+	MemoryPool_Data &pool,
+	void *data
+) {
+	*(void **)data = pool.free_list;
+	pool.free_list = data;
+}
+
+instant MemoryPool_Cache *
+_MemoryPool_GetCache(
+	MemoryPool_Data &pool
+) {
+	MemoryPool_Cache *cache_empty = nullptr;
+
+	FOR(MEMORY_POOL_CACHE_COUNT, it) {
+		MemoryPool_Cache *t_cache = &memory_pool_caches[it];
+
+		if (t_cache->pool == &pool)
+			return t_cache;
+
+		if (!cache_empty AND !t_cache->pool)
+			cache_empty = t_cache;
+	}
+
+	if (cache_empty) {
+		cache_empty->pool = &pool;
+		memory_pool_thread_exit.is_active = true;
+	}
+
+	return cache_empty;
+}
+
+inline
+MemoryPool_ThreadExit::~MemoryPool_ThreadExit() {
+	if (!is_active)
+		return;
+
+	FOR(MEMORY_POOL_CACHE_COUNT, it) {
+		MemoryPool_Cache *t_cache = &memory_pool_caches[it];
+
+		if (!t_cache->pool)
+			continue;
+
+		_MemoryPool_Lock(*t_cache->pool);
+
+		while(t_cache->count)
+			_MemoryPool_Push(*t_cache->pool, t_cache->slots[--t_cache->count]);
+
+		_MemoryPool_Unlock(*t_cache->pool);
+
+		*t_cache = {};
+	}
+}
+
+instant void *
+_MemoryPool_Alloc(
+	MemoryPool_Data &pool
+) {
+	Assert(pool.slot_size);
+
+	void *data = nullptr;
+
+	MemoryPool_Cache *cache = nullptr;
+
+	if (pool.use_thread_cache)
+		cache = _MemoryPool_GetCache(pool);
+
+	if (cache) {
+		/// refill half of the cache at once
+		if (!cache->count) {
+			_MemoryPool_Lock(pool);
+
+			while(cache->count < MEMORY_POOL_CACHE_SIZE / 2)
+				cache->slots[cache->count++] = _MemoryPool_Pop(pool);
+
+			_MemoryPool_Unlock(pool);
+		}
+
+		data = cache->slots[--cache->count];
+	}
+	else {
+		_MemoryPool_Lock(pool);
+		data = _MemoryPool_Pop(pool);
+		_MemoryPool_Unlock(pool);
+	}
+
+	InterlockedIncrement(&pool.count_used);
+
+	Memory_Set(data, 0, pool.slot_size);
+
+	((Memory_Header *)data - 1)->sig = MEMORY_SIGNATURE_POOL;
+
+	return data;
+}
+
+/// also used by Memory_Resize
+instant u64
+_MemoryPool_GetSlotSize(
+	void *data
+) {
+	MemoryPool_Data *pool = *(MemoryPool_Data **)((char *)data - MEMORY_POOL_HEADER_SIZE);
+
+	return pool->slot_size;
+}
+
+/// also used by Memory_Free
+instant void
+_MemoryPool_FreeSlot(
+	void *data
+) {
+	Memory_Header *header = (Memory_Header *)data - 1;
+
+	if (header->sig != MEMORY_SIGNATURE_POOL) {
+		AssertMessage(false, "Memory pool slot is not in use (double free?).");
+		return;
+	}
+
+	header->sig = MEMORY_SIGNATURE_POOL_FREE;
+
+	MemoryPool_Data &pool = **(MemoryPool_Data **)((char *)data - MEMORY_POOL_HEADER_SIZE);
+
+	InterlockedDecrement(&pool.count_used);
+
+	MemoryPool_Cache *cache = nullptr;
+
+	if (pool.use_thread_cache)
+		cache = _MemoryPool_GetCache(pool);
+
+	if (cache) {
+		/// return half of the cache at once
+		if (cache->count == MEMORY_POOL_CACHE_SIZE) {
+			_MemoryPool_Lock(pool);
+
+			while(cache->count > MEMORY_POOL_CACHE_SIZE / 2)
+				_MemoryPool_Push(pool, cache->slots[--cache->count]);
+
+			_MemoryPool_Unlock(pool);
+		}
+
+		cache->slots[cache->count++] = data;
+	}
+	else {
+		_MemoryPool_Lock(pool);
+		_MemoryPool_Push(pool, data);
+		_MemoryPool_Unlock(pool);
+	}
+}
+
+/// memory is cleared to 0, like with Memory_Create
+template <typename T>
+instant T *
+MemoryPool_Alloc(
+	MemoryPool<T> &pool
+) {
+	return (T *)_MemoryPool_Alloc(pool.data);
+}
+
+/// same as using Memory_Free
+template <typename T>
+instant void
+MemoryPool_Free(
+	MemoryPool<T> &pool,
+	T *data
+) {
+	if (!data)
+		return;
+
+	Assert(*(MemoryPool_Data **)((char *)data - MEMORY_POOL_HEADER_SIZE) == &pool.data);
+
+	_MemoryPool_FreeSlot(data);
+}
+
+/// Frees every slab, so every slot will be invalid.
+///
+/// @Important: with thread caches, other threads that used
+///             the pool must have ended, since they return
+///             their cached slots on exit
+template <typename T>
+instant void
+MemoryPool_Destroy(
+	MemoryPool<T> &pool
+) {
+	if (pool.data.count_used)
+		LOG_WARNING("Memory pool destroyed with slots still in use.");
+
+	void *slab = pool.data.slabs;
+
+	while(slab) {
+		void *slab_next = *(void **)slab;
+		Memory_Free(slab);
+		slab = slab_next;
+	}
+
+	FOR(MEMORY_POOL_CACHE_COUNT, it) {
+		MemoryPool_Cache *t_cache = &memory_pool_caches[it];
+
+		if (t_cache->pool == &pool.data)
+			*t_cache = {};
+	}
+
+	u64  slab_count = pool.data.slab_count;
+	bool use_thread_cache = pool.data.use_thread_cache;
+
+	pool = MemoryPool_Create<T>(slab_count, use_thread_cache);
+}
@@ -13,6 +13,13 @@ operator == (
 	return mem1.memory == mem2.memory;
 }
 
+instant u64
+MemorySegment_GetHash(
+	const MemorySegment &segment
+) {
+	return Hash_Get(segment.memory);
+}
+
 instant void
 MemorySegment_Add(
 	Array<MemorySegment> *a_segments,
@@ -20,6 +27,9 @@ MemorySegment_Add(
 ) {
 	Assert(a_segments);
 
+	if (!a_segments->index)
+		Array_EnableIndex(*a_segments, MemorySegment_GetHash);
+
 	Array_AddUnique(*a_segments, segment);
 }
 
@@ -746,6 +746,8 @@ Network_HTTP_GetResponseRef(
 	if (Network_HasError(network))
 		return false;
 
+	MEMORY_TAG("Network_HTTP_GetResponseRef");
+
 	if (!(   network->HTTP.stage == NETWORK_HTTP_STAGE_REQUESTED
 		  OR network->HTTP.stage == NETWORK_HTTP_STAGE_RESPONSED_HEADER
 		  OR network->HTTP.stage == NETWORK_HTTP_STAGE_RESPONSED_DATA)
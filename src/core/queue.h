@@ -0,0 +1,333 @@
+#pragma once
+
+/// Lock-free, fixed-capacity queues to hand data between threads.
+///
+/// Queue_SPSC: exactly one producer and one consumer thread
+/// Queue_MPMC: any number of producer and consumer threads (Vyukov)
+///
+/// Capacity gets rounded up to a power of 2. Push fails when the
+/// queue is full and Pop fails when it is empty, so the caller
+/// decides how to wait (spin, Sleep, drop the data).
+///
+/// Elements get copied as-is, the queue does not own their memory
+/// (same as Array).
+
+/// head and tail are kept on separate cache lines,
+/// so producer and consumer do not invalidate each other's line
+#define QUEUE_CACHE_LINE 64
+
+template <typename T>
+struct Queue_SPSC {
+	T   *memory   = nullptr;
+	u64  capacity = 0;
+	u64  mask     = 0;
+
+	/// written by the producer only
+	alignas(QUEUE_CACHE_LINE) u64 tail = 0;
+	u64  head_cached = 0;
+
+	/// written by the consumer only
+	alignas(QUEUE_CACHE_LINE) u64 head = 0;
+	u64  tail_cached = 0;
+};
+
+template <typename T>
+struct Queue_MPMC_Cell {
+	/// position, the cell is ready for:
+	/// pos     -> empty, can be written by the producer of pos
+	/// pos + 1 -> full,  can be read by the consumer of pos
+	u64 sequence;
+	T   value;
+};
+
+template <typename T>
+struct Queue_MPMC {
+	Queue_MPMC_Cell<T> *cells = nullptr;
+	u64  capacity = 0;
+	u64  mask     = 0;
+
+	alignas(QUEUE_CACHE_LINE) u64 enqueue_pos = 0;
+	alignas(QUEUE_CACHE_LINE) u64 dequeue_pos = 0;
+};
+
+constexpr
+instant u64
+_Queue_GetCapacity(
+	u64 capacity
+) {
+	u64 result = 2;
+
+	while(result < capacity)
+		result <<= 1;
+
+	return result;
+}
+
+/// ::: SPSC
+/// ===========================================================================
+template <typename T>
+instant void
+Queue_Create(
+	Queue_SPSC<T> &queue_out,
+	u64 capacity
+) {
+	queue_out = {};
+	queue_out.capacity = _Queue_GetCapacity(capacity);
+	queue_out.mask     = queue_out.capacity - 1;
+	queue_out.memory   = Memory_Create(T, queue_out.capacity);
+}
+
+template <typename T>
+instant void
+Queue_Destroy(
+	Queue_SPSC<T> &queue_out
+) {
+	Memory_Free(queue_out.memory);
+	queue_out = {};
+}
+
+/// producer thread only
+///
+/// returns the number of pushed elements, which can be less
+/// than count, when the queue is full
+template <typename T>
+instant u64
+Queue_PushBatch(
+	Queue_SPSC<T> &queue,
+	const T *values,
+	u64 count
+) {
+	u64 tail = queue.tail;
+
+	/// only load the consumer's head (another cache line),
+	/// when the last known one does not leave enough space
+	if (tail + count - queue.head_cached > queue.capacity)
+		queue.head_cached = __atomic_load_n(&queue.head, __ATOMIC_ACQUIRE);
+
+	count = MIN(count, queue.capacity - (tail - queue.head_cached));
+
+	FOR(count, it) {
+		queue.memory[(tail + it) & queue.mask] = values[it];
+	}
+
+	/// publishes the elements to the consumer
+	__atomic_store_n(&queue.tail, tail + count, __ATOMIC_RELEASE);
+
+	return count;
+}
+
+template <typename T>
+instant bool
+Queue_Push(
+	Queue_SPSC<T> &queue,
+	const T &value
+) {
+	return (Queue_PushBatch(queue, &value, 1) == 1);
+}
+
+/// consumer thread only
+///
+/// returns the number of popped elements
+template <typename T>
+instant u64
+Queue_PopBatch(
+	Queue_SPSC<T> &queue,
+	T *values_out,
+	u64 count
+) {
+	u64 head = queue.head;
+
+	if (head + count > queue.tail_cached)
+		queue.tail_cached = __atomic_load_n(&queue.tail, __ATOMIC_ACQUIRE);
+
+	count = MIN(count, queue.tail_cached - head);
+
+	FOR(count, it) {
+		values_out[it] = queue.memory[(head + it) & queue.mask];
+	}
+
+	/// gives the slots back to the producer
+	__atomic_store_n(&queue.head, head + count, __ATOMIC_RELEASE);
+
+	return count;
+}
+
+template <typename T>
+instant bool
+Queue_Pop(
+	Queue_SPSC<T> &queue,
+	T *value_out
+) {
+	Assert(value_out);
+
+	return (Queue_PopBatch(queue, value_out, 1) == 1);
+}
+
+/// approximate, while other threads push or pop
+template <typename T>
+instant u64
+Queue_Count(
+	Queue_SPSC<T> &queue
+) {
+	u64 head = __atomic_load_n(&queue.head, __ATOMIC_ACQUIRE);
+	u64 tail = __atomic_load_n(&queue.tail, __ATOMIC_ACQUIRE);
+
+	return tail - head;
+}
+
+/// ::: MPMC
+/// ===========================================================================
+template <typename T>
+instant void
+Queue_Create(
+	Queue_MPMC<T> &queue_out,
+	u64 capacity
+) {
+	queue_out = {};
+	queue_out.capacity = _Queue_GetCapacity(capacity);
+	queue_out.mask     = queue_out.capacity - 1;
+	queue_out.cells    = Memory_Create(Queue_MPMC_Cell<T>, queue_out.capacity);
+
+	FOR(queue_out.capacity, it) {
+		queue_out.cells[it].sequence = it;
+	}
+}
+
+template <typename T>
+instant void
+Queue_Destroy(
+	Queue_MPMC<T> &queue_out
+) {
+	Memory_Free(queue_out.cells);
+	queue_out = {};
+}
+
+/// claims up to count consecutive cells, which are ready for
+/// position + offset, with a single compare-exchange
+///
+/// returns the number of claimed cells, starting at pos_out
+template <typename T>
+instant u64
+_Queue_Claim(
+	Queue_MPMC<T> &queue,
+	u64 &position,
+	u64 count,
+	u64 offset,
+	u64 *pos_out
+) {
+	u64 pos = __atomic_load_n(&position, __ATOMIC_RELAXED);
+
+	while(true) {
+		u64 count_ready = 0;
+
+		while(count_ready < count) {
+			Queue_MPMC_Cell<T> &cell = queue.cells[(pos + count_ready) & queue.mask];
+
+			if (__atomic_load_n(&cell.sequence, __ATOMIC_ACQUIRE) != pos + count_ready + offset)
+				break;
+
+			++count_ready;
+		}
+
+		if (!count_ready) {
+			Queue_MPMC_Cell<T> &cell = queue.cells[pos & queue.mask];
+			s64 diff = (s64)(__atomic_load_n(&cell.sequence, __ATOMIC_ACQUIRE) - (pos + offset));
+
+			/// full (push) or empty (pop)
+			if (diff < 0)
+				return 0;
+
+			/// another thread claimed pos already
+			pos = __atomic_load_n(&position, __ATOMIC_RELAXED);
+			continue;
+		}
+
+		/// loads the current position into pos on failure
+		if (__atomic_compare_exchange_n(&position, &pos, pos + count_ready, true,
+										__ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+			*pos_out = pos;
+			return count_ready;
+		}
+	}
+}
+
+/// any thread
+///
+/// returns the number of pushed elements, which can be less
+/// than count, when the queue is full
+template <typename T>
+instant u64
+Queue_PushBatch(
+	Queue_MPMC<T> &queue,
+	const T *values,
+	u64 count
+) {
+	u64 pos;
+	count = _Queue_Claim(queue, queue.enqueue_pos, count, 0, &pos);
+
+	FOR(count, it) {
+		Queue_MPMC_Cell<T> &cell = queue.cells[(pos + it) & queue.mask];
+
+		cell.value = values[it];
+		__atomic_store_n(&cell.sequence, pos + it + 1, __ATOMIC_RELEASE);
+	}
+
+	return count;
+}
+
+template <typename T>
+instant bool
+Queue_Push(
+	Queue_MPMC<T> &queue,
+	const T &value
+) {
+	return (Queue_PushBatch(queue, &value, 1) == 1);
+}
+
+/// any thread
+///
+/// returns the number of popped elements
+template <typename T>
+instant u64
+Queue_PopBatch(
+	Queue_MPMC<T> &queue,
+	T *values_out,
+	u64 count
+) {
+	u64 pos;
+	count = _Queue_Claim(queue, queue.dequeue_pos, count, 1, &pos);
+
+	FOR(count, it) {
+		Queue_MPMC_Cell<T> &cell = queue.cells[(pos + it) & queue.mask];
+
+		values_out[it] = cell.value;
+
+		/// ready for the producer of the next round
+		__atomic_store_n(&cell.sequence, pos + it + queue.capacity, __ATOMIC_RELEASE);
+	}
+
+	return count;
+}
+
+template <typename T>
+instant bool
+Queue_Pop(
+	Queue_MPMC<T> &queue,
+	T *value_out
+) {
+	Assert(value_out);
+
+	return (Queue_PopBatch(queue, value_out, 1) == 1);
+}
+
+/// approximate, while other threads push or pop
+template <typename T>
+instant u64
+Queue_Count(
+	Queue_MPMC<T> &queue
+) {
+	u64 dequeue_pos = __atomic_load_n(&queue.dequeue_pos, __ATOMIC_RELAXED);
+	u64 enqueue_pos = __atomic_load_n(&queue.enqueue_pos, __ATOMIC_RELAXED);
+
+	return (enqueue_pos > dequeue_pos) ? enqueue_pos - dequeue_pos : 0;
+}
@@ -0,0 +1,289 @@
+#pragma once
+
+/// Stores up to N elements inside the struct and moves them to the
+/// heap, when more get added. Tiny arrays (f.e. the extensions of a
+/// file filter) then need no allocation at all.
+///
+/// Supports ARRAY_IT, FOR_ARRAY and the common Array_* functions.
+///
+/// There is no pointer into the struct itself, so it can be moved
+/// with Memory_Copy / resizing like every other element. Copying
+/// it while inline copies the elements, copying it after it moved
+/// to the heap shares the memory (same as Array).
+///
+/// @Important: inline copies do not see changes of each other,
+///             unlike copies of an Array. Elements, which own memory
+///             themselves (f.e. an Array), can then be resized in one
+///             copy and left dangling in the other one.
+
+template <typename T, u64 N>
+struct SmallArray {
+    static_assert(N > 0, "SmallArray needs inline capacity.");
+
+    /// only set, once the elements moved to the heap
+    T    *heap  = nullptr;
+    u64   count = 0;
+    u64   max   = N;
+
+    u64   last_search_index_found = 0;
+
+    T     buffer[N];
+};
+
+template <typename T, u64 N>
+constexpr
+instant T *
+_Array_GetMemory(
+    SmallArray<T, N> &arr
+) {
+    return (arr.heap) ? arr.heap : arr.buffer;
+}
+
+template <typename T, u64 N>
+constexpr
+instant const T *
+_Array_GetMemory(
+    const SmallArray<T, N> &arr
+) {
+    return (arr.heap) ? arr.heap : arr.buffer;
+}
+
+template <typename T, u64 N>
+constexpr
+instant bool
+SmallArray_IsInline(
+    const SmallArray<T, N> &arr
+) {
+    return (arr.heap == nullptr);
+}
+
+/// grows geometric, the inline elements get copied once
+template <typename T, u64 N>
+constexpr
+instant void
+_SmallArray_Grow(
+    SmallArray<T, N> &arr,
+    u64 count_required,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
+) {
+    if (count_required <= arr.max)
+        return;
+
+    u64 new_max = MAX(count_required, arr.max * 2);
+
+    if (arr.heap) {
+        arr.heap = (T *)_Memory_Resize(arr.heap, new_max * sizeof(T), file, line);
+    }
+    else {
+        arr.heap = (T *)_Memory_Alloc_Empty(new_max * sizeof(T), file, line);
+        Memory_Copy(arr.heap, arr.buffer, arr.count * sizeof(T));
+    }
+
+    arr.max = new_max;
+}
+
+template <typename T, u64 N>
+constexpr
+instant T *
+Array_Add(
+    SmallArray<T, N> &arr,
+    const T element,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
+) {
+    _SmallArray_Grow(arr, arr.count + 1, file, line);
+
+    T *target = &ARRAY_IT(arr, arr.count);
+    *target = element;
+
+    arr.count += 1;
+
+    return target;
+}
+
+template <typename T, u64 N>
+constexpr
+instant u64
+Array_AddEmpty(
+    SmallArray<T, N> &arr,
+    T **element_empty_out,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
+) {
+    Assert(element_empty_out);
+
+    T t_element_empty = {};
+    *element_empty_out = Array_Add(arr, t_element_empty, file, line);
+
+    return arr.count - 1;
+}
+
+template <typename T, u64 N>
+constexpr
+instant void
+Array_Reserve(
+    SmallArray<T, N> &arr,
+    u64 count,
+    const char *file = __builtin_FILE(),
+    u32 line = __builtin_LINE()
+) {
+    _SmallArray_Grow(arr, arr.count + count, file, line);
+}
+
+template <typename T, u64 N>
+constexpr
+instant bool
+Array_Find(
+    SmallArray<T, N> &arr,
+    T find,
+    u64 *index = 0
+) {
+    FOR_ARRAY(arr, it) {
+        if (ARRAY_IT(arr, it) == find) {
+            if (index)
+                *index = it;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename T, typename F, typename Func, u64 N>
+constexpr
+instant bool
+Array_Find(
+    SmallArray<T, N> &arr,
+    F find,
+    u64 *index_opt,
+    Func OnSearch
+) {
+    FOR_ARRAY(arr, it) {
+        if (OnSearch(ARRAY_IT(arr, it), find)) {
+            if (index_opt)
+                *index_opt = it;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// true if found / existed already
+template <typename T, u64 N>
+constexpr
+instant bool
+Array_FindOrAdd(
+    SmallArray<T, N> &arr,
+    T find,
+    T **entry_out_opt = 0
+) {
+    u64 t_index_find;
+    bool found_element = Array_Find(arr, find, &t_index_find);
+
+    if (!found_element) {
+        Array_Add(arr, find);
+        t_index_find = arr.count - 1;
+    }
+
+    if (entry_out_opt)
+        *entry_out_opt = &ARRAY_IT(arr, t_index_find);
+
+    return found_element;
+}
+
+template <typename T, u64 N>
+constexpr
+instant bool
+Array_AddUnique(
+    SmallArray<T, N> &arr,
+    T   element,
+    T** added_element = 0
+) {
+    return !Array_FindOrAdd(arr, element, added_element);
+}
+
+/// Returns T, so dynamic memory can still be free'd
+template <typename T, u64 N>
+constexpr
+instant T
+Array_Remove(
+    SmallArray<T, N> &arr,
+    u64 index
+) {
+    Assert(index < arr.count);
+
+    T *memory = _Array_GetMemory(arr);
+    T  result = memory[index];
+
+    Memory_Copy(memory + index,
+                memory + index + 1,
+                (arr.count - index - 1) * sizeof(T));
+
+    arr.count -= 1;
+
+    return result;
+}
+
+/// Replaces the entry with the last one,
+/// so the order of entries will not be kept.
+template <typename T, u64 N>
+constexpr
+instant T
+Array_RemoveSwap(
+    SmallArray<T, N> &arr,
+    u64 index
+) {
+    Assert(index < arr.count);
+
+    T result = ARRAY_IT(arr, index);
+
+    ARRAY_IT(arr, index) = ARRAY_IT(arr, arr.count - 1);
+
+    arr.count -= 1;
+
+    return result;
+}
+
+/// keeps the heap memory, if there is any
+template <typename T, u64 N>
+constexpr
+instant void
+Array_ClearContainer(
+    SmallArray<T, N> &arr_out
+) {
+    arr_out.count = 0;
+}
+
+template <typename T, u64 N>
+constexpr
+instant void
+Array_DestroyContainer(
+    SmallArray<T, N> &arr_out
+) {
+    if (arr_out.heap)
+        Memory_Free(arr_out.heap);
+
+    arr_out = {};
+}
+
+template <typename T, u64 N>
+constexpr
+instant bool
+Array_IsEmpty(
+    const SmallArray<T, N> &arr
+) {
+    return (arr.count == 0);
+}
+
+template <typename T, u64 N>
+constexpr
+instant u64
+Array_Count(
+    const SmallArray<T, N> &arr
+) {
+    return arr.count;
+}
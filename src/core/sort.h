@@ -28,6 +28,22 @@ struct Sort_Data {
 	s32 (*OnCompare)(const T &one, const T &two) = 0;
 };
 
+/// OnCompare can either return bool (one < two)
+/// or s32 (< 0, if one comes before two)
+template <typename Func, typename T>
+constexpr
+instant bool
+_Sort_IsLess(
+	Func &OnCompare,
+	T &one,
+	T &two
+) {
+	if constexpr (std::is_same<decltype(OnCompare(one, two)), bool>::value)
+		return OnCompare(one, two);
+	else
+		return (OnCompare(one, two) < 0);
+}
+
 template <typename T>
 instant void
 Sort_Bubble(
@@ -82,57 +98,492 @@ Sort_Insertion(
     }
 }
 
+/// partitions below use insertion sort
+#define SORT_INSERTION_THRESHOLD		24
+
+/// partitions above use the median of 3 medians (ninther) as pivot
+#define SORT_NINTHER_THRESHOLD			128
+
+/// element moves, before a partial insertion sort gives up
+#define SORT_PARTIAL_INSERTION_LIMIT	8
+
+template <typename T, typename Func>
+instant void
+_Sort_HeapSift(
+	T *begin,
+	u64 index,
+	u64 count,
+	Func OnCompare
+) {
+	T value = begin[index];
+
+	while(true) {
+		u64 index_child = index * 2 + 1;
+
+		if (index_child >= count)
+			break;
+
+		if (    index_child + 1 < count
+			AND _Sort_IsLess(OnCompare, begin[index_child], begin[index_child + 1])
+		)
+			++index_child;
+
+		if (!_Sort_IsLess(OnCompare, value, begin[index_child]))
+			break;
+
+		begin[index] = begin[index_child];
+		index = index_child;
+	}
+
+	begin[index] = value;
+}
+
+/// end: exclusive
+template <typename T, typename Func>
+instant void
+_Sort_Heap(
+	T *begin,
+	T *end,
+	Func OnCompare
+) {
+	u64 count = end - begin;
+
+	if (count <= 1)
+		return;
+
+	for(u64 it = count / 2; it > 0; --it)
+		_Sort_HeapSift(begin, it - 1, count, OnCompare);
+
+	for(u64 it = count - 1; it > 0; --it) {
+		SWAP(T, &begin[0], &begin[it]);
+		_Sort_HeapSift(begin, 0, it, OnCompare);
+	}
+}
+
+/// guaranteed O(n log n), but slower than Sort_Quick on average
 template <typename T>
 instant void
-Sort_Quick(
+Sort_Heap(
 	Sort_Data<T> sort_data
 ) {
-	T *left  = sort_data.begin_io;
-	T *right = sort_data.end_io;
+	_Sort_Heap(sort_data.begin_io, sort_data.end_io + 1, sort_data.OnCompare);
+}
+
+/// end: exclusive
+template <typename T, typename Func>
+instant void
+_Sort_InsertionRange(
+	T *begin,
+	T *end,
+	Func OnCompare
+) {
+	if (begin == end)
+		return;
+
+	for(T *it = begin + 1; it != end; ++it) {
+		T *sift = it;
+
+		if (!_Sort_IsLess(OnCompare, *it, *(it - 1)))
+			continue;
 
-	/// middle of the continuous memory
-	T  pivot = *(left + ((right - left) >> 1));
+		T value = *it;
+
+		do {
+			*sift = *(sift - 1);
+			--sift;
+		} while(sift != begin AND _Sort_IsLess(OnCompare, value, *(sift - 1)));
+
+		*sift = value;
+	}
+}
 
-	if ((right - left) < 30) {
-		Sort_Insertion(sort_data);
+/// expects an element in front of begin,
+/// which is not greater than any element of the range
+template <typename T, typename Func>
+instant void
+_Sort_InsertionUnguarded(
+	T *begin,
+	T *end,
+	Func OnCompare
+) {
+	if (begin == end)
 		return;
+
+	for(T *it = begin + 1; it != end; ++it) {
+		T *sift = it;
+
+		if (!_Sort_IsLess(OnCompare, *it, *(it - 1)))
+			continue;
+
+		T value = *it;
+
+		do {
+			*sift = *(sift - 1);
+			--sift;
+		} while(_Sort_IsLess(OnCompare, value, *(sift - 1)));
+
+		*sift = value;
+	}
+}
+
+/// returns false, if too many elements had to be moved
+/// (range is only partially sorted in that case)
+template <typename T, typename Func>
+instant bool
+_Sort_InsertionPartial(
+	T *begin,
+	T *end,
+	Func OnCompare
+) {
+	if (begin == end)
+		return true;
+
+	u64 count_moved = 0;
+
+	for(T *it = begin + 1; it != end; ++it) {
+		T *sift = it;
+
+		if (!_Sort_IsLess(OnCompare, *it, *(it - 1)))
+			continue;
+
+		T value = *it;
+
+		do {
+			*sift = *(sift - 1);
+			--sift;
+		} while(sift != begin AND _Sort_IsLess(OnCompare, value, *(sift - 1)));
+
+		*sift = value;
+
+		count_moved += it - sift;
+
+		if (count_moved > SORT_PARTIAL_INSERTION_LIMIT)
+			return false;
 	}
 
-	while(left <= right) {
-        while(sort_data.OnCompare(*left , pivot) < 0)
-			++left;
+	return true;
+}
 
-		while(sort_data.OnCompare(*right, pivot) > 0)
-			--right;
+/// compare-exchanges every pair without early exit, so the compiler can
+/// use conditional moves instead of unpredictable branches
+///
+/// only faster for small ranges of register sized types
+template <typename T, typename Func>
+instant void
+_Sort_InsertionBranchless(
+	T *begin,
+	T *end,
+	Func OnCompare
+) {
+	for(T *it = begin + 1; it < end; ++it) {
+		for(T *sift = it; sift > begin; --sift) {
+			T one = *(sift - 1);
+			T two = *sift;
 
-		if (left <= right) {
-			SWAP(T, left, right);
+			bool is_less = _Sort_IsLess(OnCompare, two, one);
 
-            ++left;
-            --right;
+			*(sift - 1) = (is_less) ? two : one;
+			*sift       = (is_less) ? one : two;
 		}
 	}
+}
+
+template <typename T, typename Func>
+instant void
+_Sort_Sort2(
+	T *a,
+	T *b,
+	Func OnCompare
+) {
+	if (_Sort_IsLess(OnCompare, *b, *a))
+		SWAP(T, a, b);
+}
+
+/// sorts the 3 elements, so b holds the median
+template <typename T, typename Func>
+instant void
+_Sort_Sort3(
+	T *a,
+	T *b,
+	T *c,
+	Func OnCompare
+) {
+	_Sort_Sort2(a, b, OnCompare);
+	_Sort_Sort2(b, c, OnCompare);
+	_Sort_Sort2(a, b, OnCompare);
+}
+
+/// pivot: first element
+///
+/// elements equal to the pivot go right,
+/// returns the final position of the pivot
+template <typename T, typename Func>
+instant T *
+_Sort_PartitionRight(
+	T *begin,
+	T *end,
+	Func OnCompare,
+	bool *is_partitioned_out
+) {
+	T pivot = *begin;
+
+	T *first = begin;
+	T *last  = end;
+
+	/// pivot is a median, so there is an element not less than it
+	while(_Sort_IsLess(OnCompare, *++first, pivot));
+
+	if (first - 1 == begin) {
+		while(first < last AND !_Sort_IsLess(OnCompare, *--last, pivot));
+	}
+	else {
+		while(!_Sort_IsLess(OnCompare, *--last, pivot));
+	}
+
+	*is_partitioned_out = (first >= last);
+
+	while(first < last) {
+		SWAP(T, first, last);
+
+		while(  _Sort_IsLess(OnCompare, *++first, pivot));
+		while(!_Sort_IsLess(OnCompare, *--last,  pivot));
+	}
+
+	T *pivot_pos = first - 1;
+	*begin     = *pivot_pos;
+	*pivot_pos = pivot;
+
+	return pivot_pos;
+}
+
+/// pivot: first element
+///
+/// elements equal to the pivot go left, used when the pivot
+/// equals the element before the range (many duplicates)
+template <typename T, typename Func>
+instant T *
+_Sort_PartitionLeft(
+	T *begin,
+	T *end,
+	Func OnCompare
+) {
+	T pivot = *begin;
+
+	T *first = begin;
+	T *last  = end;
+
+	while(_Sort_IsLess(OnCompare, pivot, *--last));
+
+	if (last + 1 == end) {
+		while(first < last AND !_Sort_IsLess(OnCompare, pivot, *++first));
+	}
+	else {
+		while(!_Sort_IsLess(OnCompare, pivot, *++first));
+	}
+
+	while(first < last) {
+		SWAP(T, first, last);
+
+		while(  _Sort_IsLess(OnCompare, pivot, *--last));
+		while(!_Sort_IsLess(OnCompare, pivot, *++first));
+	}
+
+	T *pivot_pos = last;
+	*begin     = *pivot_pos;
+	*pivot_pos = pivot;
+
+	return pivot_pos;
+}
+
+/// swaps a few elements of a badly partitioned range,
+/// to break patterns, which could cause it again
+template <typename T>
+instant void
+_Sort_BreakPatterns(
+	T *begin,
+	T *end
+) {
+	u64 count = end - begin;
+
+	if (count < SORT_INSERTION_THRESHOLD)
+		return;
+
+	u64 quarter = count / 4;
+
+	SWAP(T, &begin[0], &begin[quarter]);
+	SWAP(T, &end[-1],  &end[-(s64)quarter]);
+
+	if (count > SORT_NINTHER_THRESHOLD) {
+		SWAP(T, &begin[1], &begin[quarter + 1]);
+		SWAP(T, &begin[2], &begin[quarter + 2]);
+		SWAP(T, &end[-2],  &end[-(s64)quarter - 1]);
+		SWAP(T, &end[-3],  &end[-(s64)quarter - 2]);
+	}
+}
+
+/// pattern-defeating quicksort
+///
+/// - bad_allowed:  unbalanced partitions, before falling back to heap sort
+/// - is_leftmost:  no element in front of the range,
+///                 that could be used as sentinel
+template <typename T, typename Func>
+instant void
+_Sort_Quick(
+	T *begin,
+	T *end,
+	Func OnCompare,
+	s32 bad_allowed,
+	bool is_leftmost
+) {
+	while(true) {
+		u64 count = end - begin;
+
+		if (count < SORT_INSERTION_THRESHOLD) {
+			if constexpr (std::is_arithmetic<T>::value OR std::is_pointer<T>::value)
+				_Sort_InsertionBranchless(begin, end, OnCompare);
+			else
+			if (is_leftmost)
+				_Sort_InsertionRange(begin, end, OnCompare);
+			else
+				_Sort_InsertionUnguarded(begin, end, OnCompare);
+
+			return;
+		}
+
+		/// move the pivot to the front
+		u64 half = count / 2;
+
+		if (count > SORT_NINTHER_THRESHOLD) {
+			_Sort_Sort3(begin,            begin + half,     end - 1, OnCompare);
+			_Sort_Sort3(begin + 1,        begin + half - 1, end - 2, OnCompare);
+			_Sort_Sort3(begin + 2,        begin + half + 1, end - 3, OnCompare);
+			_Sort_Sort3(begin + half - 1, begin + half,     begin + half + 1, OnCompare);
+
+			SWAP(T, begin, begin + half);
+		}
+		else {
+			_Sort_Sort3(begin + half, begin, end - 1, OnCompare);
+		}
+
+		/// pivot equals the element in front of the range, which is not
+		/// greater than anything in it, so all equal elements can be skipped
+		if (!is_leftmost AND !_Sort_IsLess(OnCompare, *(begin - 1), *begin)) {
+			begin = _Sort_PartitionLeft(begin, end, OnCompare) + 1;
+			continue;
+		}
+
+		bool is_partitioned;
+		T *pivot_pos = _Sort_PartitionRight(begin, end, OnCompare, &is_partitioned);
+
+		u64 count_left  = pivot_pos - begin;
+		u64 count_right = end - (pivot_pos + 1);
+
+		if (count_left < count / 8 OR count_right < count / 8) {
+			if (--bad_allowed == 0) {
+				_Sort_Heap(begin, end, OnCompare);
+				return;
+			}
+
+			_Sort_BreakPatterns(begin, pivot_pos);
+			_Sort_BreakPatterns(pivot_pos + 1, end);
+		}
+		else
+		if (    is_partitioned
+			AND _Sort_InsertionPartial(begin, pivot_pos, OnCompare)
+			AND _Sort_InsertionPartial(pivot_pos + 1, end, OnCompare)
+		) {
+			/// probably (nearly) sorted input
+			return;
+		}
 
-	/// "left" and "right" switched sides at ths point
-	if (sort_data.begin_io < right) {
-		Sort_Data<T> t_sort_data;
-		t_sort_data.begin_io  = sort_data.begin_io;
-		t_sort_data.end_io    = right;
-		t_sort_data.OnCompare = sort_data.OnCompare;
+		/// recurse into the smaller side, so the stack stays at O(log n)
+		if (count_left < count_right) {
+			_Sort_Quick(begin, pivot_pos, OnCompare, bad_allowed, is_leftmost);
+
+			begin = pivot_pos + 1;
+			is_leftmost = false;
+		}
+		else {
+			_Sort_Quick(pivot_pos + 1, end, OnCompare, bad_allowed, false);
 
-		Sort_Quick(t_sort_data);
+			end = pivot_pos;
+		}
 	}
+}
+
+/// returns true, if the range is sorted (or was reversed into order)
+///
+/// only scans, until the first element breaks the run
+template <typename T, typename Func>
+instant bool
+_Sort_IsRunSorted(
+	T *begin,
+	T *end,
+	Func OnCompare
+) {
+	u64 count = end - begin;
 
-	if (left < sort_data.end_io) {
-		Sort_Data<T> t_sort_data;
-		t_sort_data.begin_io  = left;
-		t_sort_data.end_io    = sort_data.end_io;
-		t_sort_data.OnCompare = sort_data.OnCompare;
+	if (count <= 1)
+		return true;
+
+	u64 it = 1;
 
-		Sort_Quick(t_sort_data);
+	if (!_Sort_IsLess(OnCompare, begin[1], begin[0])) {
+		while(it < count AND !_Sort_IsLess(OnCompare, begin[it], begin[it - 1]))
+			++it;
+
+		return (it == count);
 	}
+
+	/// strictly descending only, otherwise
+	/// reversing could swap equal elements
+	while(it < count AND _Sort_IsLess(OnCompare, begin[it], begin[it - 1]))
+		++it;
+
+	if (it != count)
+		return false;
+
+	for(T *left = begin, *right = end - 1; left < right; ++left, --right)
+		SWAP(T, left, right);
+
+	return true;
+}
+
+/// introsort (pattern-defeating quicksort):
+///
+/// - median of 3 / ninther pivots
+/// - falls back to heap sort on bad partitions, so it stays O(n log n)
+/// - sorted and reversed input is detected in O(n)
+/// - recursion depth is O(log n)
+///
+/// end: exclusive
+template <typename T, typename Func>
+instant void
+_Sort_Introsort(
+	T *begin,
+	T *end,
+	Func OnCompare
+) {
+	if (_Sort_IsRunSorted(begin, end, OnCompare))
+		return;
+
+	s32 bad_allowed = 1;
+
+	for(u64 count = end - begin; count > 1; count >>= 1)
+		++bad_allowed;
+
+	_Sort_Quick(begin, end, OnCompare, bad_allowed, true);
+}
+
+template <typename T>
+instant void
+Sort_Quick(
+	Sort_Data<T> sort_data
+) {
+	_Sort_Introsort(sort_data.begin_io, sort_data.end_io + 1, sort_data.OnCompare);
 }
 
+/// function pointer version, every comparison is an indirect call
 template <typename T>
 instant void
 Array_Sort(
@@ -144,6 +595,8 @@ Array_Sort(
 	if(!array_io->count)
 		return;
 
+	_Array_IndexInvalidate(*array_io);
+
 	Sort_Data<T> sort_data;
 	sort_data.begin_io  = &array_io->memory[0];
 	sort_data.end_io    = &array_io->memory[array_io->count - 1];
@@ -152,7 +605,40 @@ Array_Sort(
 	Sort_Quick(sort_data);
 }
 
+/// OnCompare: functor or lambda, which will be inlined
+///
+/// - returns bool: one < two
+/// - returns s32:  < 0, if one comes before two
+template <typename T, typename Func>
+instant void
+Array_Sort(
+	Array<T> &arr,
+	Func OnCompare
+) {
+	if (!arr.count)
+		return;
+
+	_Array_IndexInvalidate(arr);
+
+	_Sort_Introsort(arr.memory, arr.memory + arr.count, OnCompare);
+}
+
 /// non-custom version
+template <typename T>
+instant void
+Array_Sort(
+	Array<T> &arr,
+	SORT_ORDER_TYPE type
+) {
+	if (type == SORT_ORDER_ASCENDING)
+		Array_Sort(arr, [](T &one, T &two) { return (one < two); });
+	else
+	if (type == SORT_ORDER_DESCENDING)
+		Array_Sort(arr, [](T &one, T &two) { return (two < one); });
+	else
+		Assert(false);
+}
+
 template <typename T>
 instant void
 Array_Sort(
@@ -161,20 +647,1100 @@ Array_Sort(
 ) {
 	Assert(array_io);
 
-	if(!array_io->count)
-		return;
+	Array_Sort(*array_io, type);
+}
 
-	Sort_Data<T> sort_data;
-	sort_data.begin_io  = &array_io->memory[0];
-	sort_data.end_io    = &array_io->memory[array_io->count - 1];
+/// bits per digit (per pass) of Array_SortRadix,
+/// more bits need fewer passes, but bigger histograms
+enum SORT_RADIX_TYPE {
+	SORT_RADIX_8  = 8,
+	SORT_RADIX_11 = 11,
+	SORT_RADIX_16 = 16
+};
 
-	if (type == SORT_ORDER_ASCENDING)
-		sort_data.OnCompare = Sort_OnCompareAscending;
+/// maps integer and float keys to unsigned integers,
+/// which have the same order
+template <typename K>
+constexpr
+instant u64
+_Sort_RadixKey(
+	K key
+) {
+	static_assert(std::is_arithmetic<K>::value, "Radix key has to be an integer or float.");
+
+	if constexpr (std::is_same<K, float>::value) {
+		u32 bits;
+		__builtin_memcpy(&bits, &key, sizeof(bits));
+
+		/// negative: reverse order, positive: above all negatives
+		return (bits & 0x80000000u) ? (u32)~bits : (bits | 0x80000000u);
+	}
 	else
-	if (type == SORT_ORDER_DESCENDING)
-		sort_data.OnCompare = Sort_OnCompareDescending;
+	if constexpr (std::is_same<K, double>::value) {
+		u64 bits;
+		__builtin_memcpy(&bits, &key, sizeof(bits));
+
+		return (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+	}
 	else
-		Assert(false);
+	if constexpr (std::is_signed<K>::value) {
+		return (u64)(typename std::make_unsigned<K>::type)key ^ ((u64)1 << (sizeof(K) * 8 - 1));
+	}
+	else {
+		return (u64)key;
+	}
+}
 
-	Sort_Quick(sort_data);
+/// digit width is a template parameter, so the
+/// pass loops can be unrolled by the compiler
+template <u64 BITS_DIGIT, typename T, typename Func>
+instant void
+_Sort_Radix(
+	Array<T> &arr,
+	Func OnKey
+) {
+	using K = typename std::decay<decltype(OnKey(arr.memory[0]))>::type;
+
+	constexpr u64 count_passes  = (sizeof(K) * 8 + BITS_DIGIT - 1) / BITS_DIGIT;
+	constexpr u64 count_buckets = (u64)1 << BITS_DIGIT;
+	constexpr u64 mask          = count_buckets - 1;
+
+	u64 count = arr.count;
+
+	MemoryArena &arena = context.arena_temp;
+	MemoryArena_Marker marker = MemoryArena_Mark(arena);
+
+	T   *scratch    = (T *)  _MemoryArena_AllocAligned(arena, count * sizeof(T), MAX(alignof(T), (u64)16));
+	u64 *histograms = (u64 *)_MemoryArena_AllocAligned(arena, count_passes * count_buckets * sizeof(u64), 64);
+
+	Memory_Set(histograms, 0, count_passes * count_buckets * sizeof(u64));
+
+	/// histograms of every pass in one run
+	FOR(count, it) {
+		u64 key = _Sort_RadixKey(OnKey(arr.memory[it]));
+
+		for(u64 pass = 0; pass < count_passes; ++pass) {
+			++histograms[pass * count_buckets + ((key >> (pass * BITS_DIGIT)) & mask)];
+		}
+	}
+
+	T *source = arr.memory;
+	T *target = scratch;
+
+	for(u64 pass = 0; pass < count_passes; ++pass) {
+		u64 *histogram = histograms + pass * count_buckets;
+		u64  shift     = pass * BITS_DIGIT;
+
+		/// every element has the same digit
+		if (histogram[(_Sort_RadixKey(OnKey(source[0])) >> shift) & mask] == count)
+			continue;
+
+		/// bucket sizes -> bucket offsets
+		u64 offset = 0;
+
+		FOR(count_buckets, it) {
+			u64 t_count = histogram[it];
+			histogram[it] = offset;
+			offset += t_count;
+		}
+
+		FOR(count, it) {
+			u64 digit = (_Sort_RadixKey(OnKey(source[it])) >> shift) & mask;
+			target[histogram[digit]++] = source[it];
+		}
+
+		SWAP(T *, &source, &target);
+	}
+
+	if (source != arr.memory)
+		Memory_Copy(arr.memory, source, count * sizeof(T));
+
+	MemoryArena_Rewind(arena, marker);
+}
+
+/// LSD radix sort (stable), O(n * key bytes)
+///
+/// OnKey: returns the integer or float key of an element
+///
+/// uses the temp arena for a copy of the array and the histograms
+template <typename T, typename Func>
+instant void
+Array_SortRadix(
+	Array<T> &arr,
+	Func OnKey,
+	SORT_RADIX_TYPE type = SORT_RADIX_8
+) {
+	static_assert(std::is_trivially_copyable<T>::value, "Radix sort copies elements as bytes.");
+
+	if (arr.count <= 1)
+		return;
+
+	_Array_IndexInvalidate(arr);
+
+	switch (type) {
+		case SORT_RADIX_8:  { _Sort_Radix< 8>(arr, OnKey); } break;
+		case SORT_RADIX_11: { _Sort_Radix<11>(arr, OnKey); } break;
+		case SORT_RADIX_16: { _Sort_Radix<16>(arr, OnKey); } break;
+
+		default: {
+			AssertMessage(false, "Unhandled radix type.");
+		} break;
+	}
+}
+
+/// for arrays of integers or floats
+template <typename T>
+instant void
+Array_SortRadix(
+	Array<T> &arr,
+	SORT_RADIX_TYPE type = SORT_RADIX_8
+) {
+	Array_SortRadix(arr, [](const T &value) { return value; }, type);
+}
+
+/// runs shorter than this get extended with binary insertion sort
+#define SORT_STABLE_RUN_MIN		32
+
+/// consecutive wins of one run, before merging switches to galloping
+#define SORT_STABLE_GALLOP_MIN	7
+
+/// enough for any array size with the merge invariants
+#define SORT_STABLE_STACK_SIZE	96
+
+/// first index, where key <= begin[index] (left-most position)
+///
+/// searches exponentially from the start, so finding a
+/// position close to it takes O(log distance)
+template <typename T, typename Func>
+instant u64
+_Sort_GallopLower(
+	T *begin,
+	u64 count,
+	T &key,
+	Func OnCompare
+) {
+	u64 low  = 0;
+	u64 high = 1;
+
+	while(high <= count AND _Sort_IsLess(OnCompare, begin[high - 1], key)) {
+		low  = high;
+		high = high * 2 + 1;
+	}
+
+	high = MIN(high, count);
+
+	while(low < high) {
+		u64 middle = low + (high - low) / 2;
+
+		if (_Sort_IsLess(OnCompare, begin[middle], key))
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	return low;
+}
+
+/// first index, where key < begin[index] (right-most position)
+template <typename T, typename Func>
+instant u64
+_Sort_GallopUpper(
+	T *begin,
+	u64 count,
+	T &key,
+	Func OnCompare
+) {
+	u64 low  = 0;
+	u64 high = 1;
+
+	while(high <= count AND !_Sort_IsLess(OnCompare, key, begin[high - 1])) {
+		low  = high;
+		high = high * 2 + 1;
+	}
+
+	high = MIN(high, count);
+
+	while(low < high) {
+		u64 middle = low + (high - low) / 2;
+
+		if (_Sort_IsLess(OnCompare, key, begin[middle]))
+			high = middle;
+		else
+			low = middle + 1;
+	}
+
+	return low;
+}
+
+/// same as _Sort_GallopLower / Upper, but searching from the end
+template <typename T, typename Func>
+instant u64
+_Sort_GallopLowerRev(
+	T *begin,
+	u64 count,
+	T &key,
+	Func OnCompare
+) {
+	u64 low  = count;
+	u64 high = count;
+	u64 step = 1;
+
+	while(low > 0 AND !_Sort_IsLess(OnCompare, begin[low - 1], key)) {
+		high = low - 1;
+		low  = (low > step) ? low - step : 0;
+		step = step * 2;
+	}
+
+	while(low < high) {
+		u64 middle = low + (high - low) / 2;
+
+		if (_Sort_IsLess(OnCompare, begin[middle], key))
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	return low;
+}
+
+template <typename T, typename Func>
+instant u64
+_Sort_GallopUpperRev(
+	T *begin,
+	u64 count,
+	T &key,
+	Func OnCompare
+) {
+	u64 low  = count;
+	u64 high = count;
+	u64 step = 1;
+
+	while(low > 0 AND _Sort_IsLess(OnCompare, key, begin[low - 1])) {
+		high = low - 1;
+		low  = (low > step) ? low - step : 0;
+		step = step * 2;
+	}
+
+	while(low < high) {
+		u64 middle = low + (high - low) / 2;
+
+		if (_Sort_IsLess(OnCompare, key, begin[middle]))
+			high = middle;
+		else
+			low = middle + 1;
+	}
+
+	return low;
+}
+
+/// stable, begin to sorted_end is already sorted
+template <typename T, typename Func>
+instant void
+_Sort_InsertionBinary(
+	T *begin,
+	T *sorted_end,
+	T *end,
+	Func OnCompare
+) {
+	for(T *it = sorted_end; it < end; ++it) {
+		T value = *it;
+
+		/// behind equal elements
+		u64 index = _Sort_GallopUpperRev(begin, it - begin, value, OnCompare);
+
+		for(T *sift = it; sift > begin + index; --sift)
+			*sift = *(sift - 1);
+
+		begin[index] = value;
+	}
+}
+
+/// returns the length of the run at begin,
+/// a strictly descending run gets reversed
+template <typename T, typename Func>
+instant u64
+_Sort_CountRun(
+	T *begin,
+	T *end,
+	Func OnCompare
+) {
+	u64 count = end - begin;
+
+	if (count <= 1)
+		return count;
+
+	u64 it = 1;
+
+	if (!_Sort_IsLess(OnCompare, begin[1], begin[0])) {
+		while(it < count AND !_Sort_IsLess(OnCompare, begin[it], begin[it - 1]))
+			++it;
+
+		return it;
+	}
+
+	/// strictly, so equal elements keep their order
+	while(it < count AND _Sort_IsLess(OnCompare, begin[it], begin[it - 1]))
+		++it;
+
+	for(T *left = begin, *right = begin + it - 1; left < right; ++left, --right)
+		SWAP(T, left, right);
+
+	return it;
+}
+
+/// merges the runs [a, b) and [b, b + count_b), copying the smaller
+/// one into the buffer (has to fit MIN(count_a, count_b) elements)
+template <typename T, typename Func>
+instant void
+_Sort_MergeRuns(
+	T *a,
+	u64 count_a,
+	T *b,
+	u64 count_b,
+	T *buffer,
+	Func OnCompare
+) {
+	/// elements of a, which are already in place
+	u64 skip = _Sort_GallopUpper(a, count_a, b[0], OnCompare);
+
+	a       += skip;
+	count_a -= skip;
+
+	if (!count_a)
+		return;
+
+	/// elements of b, which are already in place
+	count_b = _Sort_GallopLowerRev(b, count_b, a[count_a - 1], OnCompare);
+
+	if (!count_b)
+		return;
+
+	u64 count_wins_a = 0;
+	u64 count_wins_b = 0;
+
+	if (count_a <= count_b) {
+		/// merge from the front, a is in the buffer
+		Memory_Copy(buffer, a, count_a * sizeof(T));
+
+		T *it_a = buffer;
+		T *it_a_end = buffer + count_a;
+		T *it_b = b;
+		T *it_b_end = b + count_b;
+		T *dest = a;
+
+		while(it_a < it_a_end AND it_b < it_b_end) {
+			if (_Sort_IsLess(OnCompare, *it_b, *it_a)) {
+				*dest++ = *it_b++;
+				++count_wins_b;
+				count_wins_a = 0;
+			}
+			else {
+				*dest++ = *it_a++;
+				++count_wins_a;
+				count_wins_b = 0;
+			}
+
+			if (    count_wins_a < SORT_STABLE_GALLOP_MIN
+				AND count_wins_b < SORT_STABLE_GALLOP_MIN)
+				continue;
+
+			/// one run keeps winning, so move whole blocks
+			if (it_b < it_b_end) {
+				u64 t_count = _Sort_GallopUpper(it_a, it_a_end - it_a, *it_b, OnCompare);
+
+				for(u64 it = 0; it < t_count; ++it)
+					*dest++ = *it_a++;
+			}
+
+			if (it_a < it_a_end) {
+				u64 t_count = _Sort_GallopLower(it_b, it_b_end - it_b, *it_a, OnCompare);
+
+				for(u64 it = 0; it < t_count; ++it)
+					*dest++ = *it_b++;
+			}
+
+			count_wins_a = 0;
+			count_wins_b = 0;
+		}
+
+		/// rest of b is already in place
+		while(it_a < it_a_end)
+			*dest++ = *it_a++;
+	}
+	else {
+		/// merge from the back, b is in the buffer
+		Memory_Copy(buffer, b, count_b * sizeof(T));
+
+		u64 index_a = count_a;
+		u64 index_b = count_b;
+		T  *dest = b + count_b;
+
+		while(index_a AND index_b) {
+			if (_Sort_IsLess(OnCompare, buffer[index_b - 1], a[index_a - 1])) {
+				*--dest = a[--index_a];
+				++count_wins_a;
+				count_wins_b = 0;
+			}
+			else {
+				*--dest = buffer[--index_b];
+				++count_wins_b;
+				count_wins_a = 0;
+			}
+
+			if (    count_wins_a < SORT_STABLE_GALLOP_MIN
+				AND count_wins_b < SORT_STABLE_GALLOP_MIN)
+				continue;
+
+			if (index_b) {
+				u64 t_index = _Sort_GallopUpperRev(a, index_a, buffer[index_b - 1], OnCompare);
+
+				while(index_a > t_index)
+					*--dest = a[--index_a];
+			}
+
+			if (index_a) {
+				u64 t_index = _Sort_GallopLowerRev(buffer, index_b, a[index_a - 1], OnCompare);
+
+				while(index_b > t_index)
+					*--dest = buffer[--index_b];
+			}
+
+			count_wins_a = 0;
+			count_wins_b = 0;
+		}
+
+		/// rest of a is already in place
+		while(index_b)
+			*--dest = buffer[--index_b];
+	}
+}
+
+/// TimSort: natural runs, extended to a minimum length with
+/// binary insertion sort, merged while keeping run lengths balanced
+///
+/// end: exclusive
+template <typename T, typename Func>
+instant void
+_Sort_Stable(
+	T *begin,
+	T *end,
+	Func OnCompare
+) {
+	static_assert(std::is_trivially_copyable<T>::value, "Stable sort copies elements as bytes.");
+
+	u64 count = end - begin;
+
+	if (count < SORT_STABLE_RUN_MIN * 2) {
+		u64 count_run = _Sort_CountRun(begin, end, OnCompare);
+		_Sort_InsertionBinary(begin, begin + count_run, end, OnCompare);
+		return;
+	}
+
+	/// run length between 32 and 64, so count / run_min is (close to) a power of 2
+	u64 run_min = count;
+	u64 run_rest = 0;
+
+	while(run_min >= SORT_STABLE_RUN_MIN * 2) {
+		run_rest |= run_min & 1;
+		run_min >>= 1;
+	}
+
+	run_min += run_rest;
+
+	/// merging never needs more than half of the elements
+	MemoryArena &arena = context.arena_temp;
+	MemoryArena_Marker marker = MemoryArena_Mark(arena);
+
+	T *buffer = (T *)_MemoryArena_AllocAligned(arena, (count / 2 + 1) * sizeof(T), MAX(alignof(T), (u64)16));
+
+	u64 stack_base[SORT_STABLE_STACK_SIZE];
+	u64 stack_count[SORT_STABLE_STACK_SIZE];
+	u64 stack_size = 0;
+
+	auto MergeAt = [&](u64 index) {
+		T *a = begin + stack_base[index];
+		T *b = begin + stack_base[index + 1];
+
+		_Sort_MergeRuns(a, stack_count[index], b, stack_count[index + 1], buffer, OnCompare);
+
+		stack_count[index] += stack_count[index + 1];
+
+		/// keep the third run, if the second and third got merged
+		if (index + 2 < stack_size) {
+			stack_base[index + 1]  = stack_base[index + 2];
+			stack_count[index + 1] = stack_count[index + 2];
+		}
+
+		--stack_size;
+	};
+
+	u64 index = 0;
+
+	while(index < count) {
+		u64 count_run = _Sort_CountRun(begin + index, end, OnCompare);
+
+		if (count_run < run_min) {
+			u64 count_forced = MIN(run_min, count - index);
+			_Sort_InsertionBinary(begin + index, begin + index + count_run, begin + index + count_forced, OnCompare);
+			count_run = count_forced;
+		}
+
+		Assert(stack_size < SORT_STABLE_STACK_SIZE);
+
+		stack_base[stack_size]  = index;
+		stack_count[stack_size] = count_run;
+		++stack_size;
+
+		index += count_run;
+
+		/// keep run lengths growing faster than fibonacci from top to bottom
+		while(stack_size > 1) {
+			u64 it = stack_size - 2;
+
+			if (   (it > 0 AND stack_count[it - 1] <= stack_count[it] + stack_count[it + 1])
+				OR (it > 1 AND stack_count[it - 2] <= stack_count[it - 1] + stack_count[it])
+			) {
+				if (stack_count[it - 1] < stack_count[it + 1])
+					--it;
+			}
+			else
+			if (stack_count[it] > stack_count[it + 1]) {
+				break;
+			}
+
+			MergeAt(it);
+		}
+	}
+
+	while(stack_size > 1) {
+		u64 it = stack_size - 2;
+
+		if (it > 0 AND stack_count[it - 1] < stack_count[it + 1])
+			--it;
+
+		MergeAt(it);
+	}
+
+	MemoryArena_Rewind(arena, marker);
+}
+
+/// keeps the order of equal elements, O(n) for (nearly) sorted input
+///
+/// OnCompare: see Array_Sort
+///
+/// uses the temp arena for a buffer of half the array size
+template <typename T, typename Func>
+instant void
+Array_SortStable(
+	Array<T> &arr,
+	Func OnCompare
+) {
+	if (arr.count <= 1)
+		return;
+
+	_Array_IndexInvalidate(arr);
+
+	_Sort_Stable(arr.memory, arr.memory + arr.count, OnCompare);
+}
+
+template <typename T>
+instant void
+Array_SortStable(
+	Array<T> &arr,
+	SORT_ORDER_TYPE type
+) {
+	if (type == SORT_ORDER_ASCENDING)
+		Array_SortStable(arr, [](T &one, T &two) { return (one < two); });
+	else
+	if (type == SORT_ORDER_DESCENDING)
+		Array_SortStable(arr, [](T &one, T &two) { return (two < one); });
+	else
+		Assert(false);
+}
+
+/// arrays with fewer elements get sorted on the calling thread
+#define SORT_PARALLEL_THRESHOLD		65536
+
+/// smallest partition a thread gets, to not spend more
+/// time creating threads than sorting
+#define SORT_PARALLEL_CHUNK_MIN		16384
+
+#define SORT_PARALLEL_THREADS_MAX	64
+
+/// sorts [a, a + count_a), if dest is not set,
+/// otherwise merges a and b into dest
+template <typename T, typename Func>
+struct _Sort_ParallelTask {
+	T  *a       = nullptr;
+	u64 count_a = 0;
+	T  *b       = nullptr;
+	u64 count_b = 0;
+	T  *dest    = nullptr;
+
+	Func *OnCompare = nullptr;
+};
+
+template <typename T, typename Func>
+instant ulong WINAPI
+_Sort_ParallelRun(
+	void *data
+) {
+	_Sort_ParallelTask<T, Func> &task = *(_Sort_ParallelTask<T, Func> *)data;
+	Func &OnCompare = *task.OnCompare;
+
+	if (!task.dest) {
+		_Sort_Introsort(task.a, task.a + task.count_a, OnCompare);
+		return 0;
+	}
+
+	T *it_a = task.a;
+	T *it_b = task.b;
+	T *it_a_end = task.a + task.count_a;
+	T *it_b_end = task.b + task.count_b;
+	T *dest = task.dest;
+
+	/// takes a on equal elements
+	while(it_a < it_a_end AND it_b < it_b_end) {
+		if (_Sort_IsLess(OnCompare, *it_b, *it_a))
+			*dest++ = *it_b++;
+		else
+			*dest++ = *it_a++;
+	}
+
+	while(it_a < it_a_end)  *dest++ = *it_a++;
+	while(it_b < it_b_end)  *dest++ = *it_b++;
+
+	return 0;
+}
+
+/// runs every task on its own thread and waits for all of them
+template <typename T, typename Func>
+instant void
+_Sort_ParallelExecute(
+	_Sort_ParallelTask<T, Func> *tasks,
+	u64 count_tasks
+) {
+	Thread threads[SORT_PARALLEL_THREADS_MAX];
+
+	/// the calling thread takes the first task itself
+	FOR_START(1, count_tasks, it) {
+		threads[it] = Thread_Create(&tasks[it], _Sort_ParallelRun<T, Func>);
+		Thread_Execute(&threads[it]);
+	}
+
+	if (count_tasks)
+		_Sort_ParallelRun<T, Func>(&tasks[0]);
+
+	FOR_START(1, count_tasks, it) {
+		Thread_WaitFor(&threads[it]);
+		Thread_Destroy(&threads[it]);
+	}
+}
+
+/// elements of a, which come before the merge output index "diagonal"
+/// (merge path), so merging a and b can be split into equal parts
+template <typename T, typename Func>
+instant u64
+_Sort_MergePathSplit(
+	T *a,
+	u64 count_a,
+	T *b,
+	u64 count_b,
+	u64 diagonal,
+	Func &OnCompare
+) {
+	u64 low  = (diagonal > count_b) ? diagonal - count_b : 0;
+	u64 high = MIN(diagonal, count_a);
+
+	while(low < high) {
+		u64 middle = low + (high - low) / 2;
+
+		if (!_Sort_IsLess(OnCompare, b[diagonal - middle - 1], a[middle]))
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	return low;
+}
+
+/// every thread sorts one partition with introsort, then the
+/// partitions get merged pairwise between the array and a buffer,
+/// with each merge split over the threads along the merge path
+///
+/// count_threads: 0 = number of logical processors
+///
+/// uses the temp arena for a buffer of the array size
+template <typename T, typename Func>
+instant void
+Array_SortParallel(
+	Array<T> &arr,
+	Func OnCompare,
+	u64 count_threads = 0
+) {
+	static_assert(std::is_trivially_copyable<T>::value, "Parallel sort copies elements as bytes.");
+
+	if (arr.count <= 1)
+		return;
+
+	_Array_IndexInvalidate(arr);
+
+	if (!count_threads)
+		count_threads = Thread_GetProcessorCount();
+
+	count_threads = MIN(count_threads, arr.count / SORT_PARALLEL_CHUNK_MIN);
+	count_threads = MIN(count_threads, (u64)SORT_PARALLEL_THREADS_MAX);
+
+	if (count_threads <= 1 OR arr.count < SORT_PARALLEL_THRESHOLD) {
+		_Sort_Introsort(arr.memory, arr.memory + arr.count, OnCompare);
+		return;
+	}
+
+	typedef _Sort_ParallelTask<T, Func> Task;
+
+	Task tasks[SORT_PARALLEL_THREADS_MAX];
+	u64  runs[SORT_PARALLEL_THREADS_MAX + 1];
+
+	u64 count_runs = count_threads;
+
+	FOR(count_runs, it) {
+		runs[it] = arr.count * it / count_runs;
+
+		Task &task = tasks[it];
+		task = {};
+		task.a       = arr.memory + runs[it];
+		task.count_a = (arr.count * (it + 1) / count_runs) - runs[it];
+		task.OnCompare = &OnCompare;
+	}
+
+	runs[count_runs] = arr.count;
+
+	_Sort_ParallelExecute(tasks, count_runs);
+
+	MemoryArena &arena = context.arena_temp;
+	MemoryArena_Marker marker = MemoryArena_Mark(arena);
+
+	T *source = arr.memory;
+	T *target = (T *)_MemoryArena_AllocAligned(arena, arr.count * sizeof(T), MAX(alignof(T), (u64)16));
+
+	while(count_runs > 1) {
+		u64 count_pairs    = (count_runs + 1) / 2;
+		u64 threads_merge  = MAX(count_threads / count_pairs, (u64)1);
+		u64 count_tasks    = 0;
+
+		FOR(count_pairs, it_pair) {
+			u64 index_a = runs[it_pair * 2];
+			u64 index_b = (it_pair * 2 + 1 < count_runs) ? runs[it_pair * 2 + 1] : runs[count_runs];
+			u64 index_e = (it_pair * 2 + 1 < count_runs) ? runs[it_pair * 2 + 2] : runs[count_runs];
+
+			T  *a = source + index_a;
+			T  *b = source + index_b;
+			u64 count_a = index_b - index_a;
+			u64 count_b = index_e - index_b;
+			u64 count_merge = count_a + count_b;
+
+			u64 split_prev = 0;
+
+			FOR(threads_merge, it_part) {
+				u64 diagonal_end = count_merge * (it_part + 1) / threads_merge;
+				u64 diagonal     = count_merge *  it_part      / threads_merge;
+
+				u64 split = (it_part + 1 == threads_merge)
+								? count_a
+								: _Sort_MergePathSplit(a, count_a, b, count_b, diagonal_end, OnCompare);
+
+				Task &task = tasks[count_tasks++];
+				task = {};
+				task.a       = a + split_prev;
+				task.count_a = split - split_prev;
+				task.b       = b + (diagonal - split_prev);
+				task.count_b = (diagonal_end - split) - (diagonal - split_prev);
+				task.dest    = target + index_a + diagonal;
+				task.OnCompare = &OnCompare;
+
+				split_prev = split;
+			}
+
+			runs[it_pair] = index_a;
+		}
+
+		runs[count_pairs] = arr.count;
+		count_runs = count_pairs;
+
+		_Sort_ParallelExecute(tasks, count_tasks);
+
+		SWAP(T *, &source, &target);
+	}
+
+	if (source != arr.memory) {
+		u64 count_tasks = count_threads;
+
+		FOR(count_tasks, it) {
+			u64 index     = arr.count *  it      / count_tasks;
+			u64 index_end = arr.count * (it + 1) / count_tasks;
+
+			Task &task = tasks[it];
+			task = {};
+			task.a       = source + index;
+			task.count_a = index_end - index;
+			task.dest    = arr.memory + index;
+			task.OnCompare = &OnCompare;
+		}
+
+		_Sort_ParallelExecute(tasks, count_tasks);
+	}
+
+	MemoryArena_Rewind(arena, marker);
+}
+
+template <typename T>
+instant void
+Array_SortParallel(
+	Array<T> &arr,
+	SORT_ORDER_TYPE type,
+	u64 count_threads = 0
+) {
+	if (type == SORT_ORDER_ASCENDING)
+		Array_SortParallel(arr, [](T &one, T &two) { return (one < two); }, count_threads);
+	else
+	if (type == SORT_ORDER_DESCENDING)
+		Array_SortParallel(arr, [](T &one, T &two) { return (two < one); }, count_threads);
+	else
+		Assert(false);
+}
+
+/// introselect: quickselect with the pivots of _Sort_Quick,
+/// falls back to heap sort on too many bad partitions
+///
+/// end: exclusive
+template <typename T, typename Func>
+instant void
+_Sort_Select(
+	T *begin,
+	T *end,
+	T *nth,
+	Func OnCompare
+) {
+	T *first = begin;
+
+	s32 bad_allowed = 1;
+
+	for(u64 count = end - begin; count > 1; count >>= 1)
+		++bad_allowed;
+
+	while(true) {
+		u64 count = end - begin;
+
+		if (count < SORT_INSERTION_THRESHOLD) {
+			_Sort_InsertionRange(begin, end, OnCompare);
+			return;
+		}
+
+		u64 half = count / 2;
+
+		if (count > SORT_NINTHER_THRESHOLD) {
+			_Sort_Sort3(begin,            begin + half,     end - 1, OnCompare);
+			_Sort_Sort3(begin + 1,        begin + half - 1, end - 2, OnCompare);
+			_Sort_Sort3(begin + 2,        begin + half + 1, end - 3, OnCompare);
+			_Sort_Sort3(begin + half - 1, begin + half,     begin + half + 1, OnCompare);
+
+			SWAP(T, begin, begin + half);
+		}
+		else {
+			_Sort_Sort3(begin + half, begin, end - 1, OnCompare);
+		}
+
+		/// pivot equals the element in front of the range, so
+		/// every element of the left partition is equal to nth
+		if (begin != first AND !_Sort_IsLess(OnCompare, *(begin - 1), *begin)) {
+			T *pivot_pos = _Sort_PartitionLeft(begin, end, OnCompare);
+
+			if (nth <= pivot_pos)
+				return;
+
+			begin = pivot_pos + 1;
+			continue;
+		}
+
+		bool is_partitioned;
+		T *pivot_pos = _Sort_PartitionRight(begin, end, OnCompare, &is_partitioned);
+
+		if (pivot_pos == nth)
+			return;
+
+		u64 count_left  = pivot_pos - begin;
+		u64 count_right = end - (pivot_pos + 1);
+
+		if (count_left < count / 8 OR count_right < count / 8) {
+			if (--bad_allowed == 0) {
+				_Sort_Heap(begin, end, OnCompare);
+				return;
+			}
+
+			_Sort_BreakPatterns(begin, pivot_pos);
+			_Sort_BreakPatterns(pivot_pos + 1, end);
+		}
+
+		if (nth < pivot_pos)
+			end = pivot_pos;
+		else
+			begin = pivot_pos + 1;
+	}
+}
+
+/// sorts the count smallest elements into [begin, begin + count),
+/// with a max-heap of the best count elements seen so far
+///
+/// O(n log count), the rest of the range is left unordered
+template <typename T, typename Func>
+instant void
+_Sort_HeapSelect(
+	T *begin,
+	T *end,
+	u64 count,
+	Func OnCompare
+) {
+	if (!count)
+		return;
+
+	for(u64 it = count / 2; it > 0; --it)
+		_Sort_HeapSift(begin, it - 1, count, OnCompare);
+
+	for(T *it = begin + count; it < end; ++it) {
+		if (_Sort_IsLess(OnCompare, *it, begin[0])) {
+			SWAP(T, it, &begin[0]);
+			_Sort_HeapSift(begin, 0, count, OnCompare);
+		}
+	}
+
+	for(u64 it = count - 1; it > 0; --it) {
+		SWAP(T, &begin[0], &begin[it]);
+		_Sort_HeapSift(begin, 0, it, OnCompare);
+	}
+}
+
+/// reorders the array, so index holds the element a full sort would
+/// put there, with no greater element before and no smaller after it
+///
+/// OnCompare: see Array_Sort
+///
+/// average O(n)
+template <typename T, typename Func>
+instant void
+Array_SelectNth(
+	Array<T> &arr,
+	u64 index,
+	Func OnCompare
+) {
+	if (index >= arr.count)
+		return;
+
+	_Array_IndexInvalidate(arr);
+
+	_Sort_Select(arr.memory, arr.memory + arr.count, arr.memory + index, OnCompare);
+}
+
+template <typename T>
+instant void
+Array_SelectNth(
+	Array<T> &arr,
+	u64 index,
+	SORT_ORDER_TYPE type
+) {
+	if (type == SORT_ORDER_ASCENDING)
+		Array_SelectNth(arr, index, [](T &one, T &two) { return (one < two); });
+	else
+	if (type == SORT_ORDER_DESCENDING)
+		Array_SelectNth(arr, index, [](T &one, T &two) { return (two < one); });
+	else
+		Assert(false);
+}
+
+/// sorts only the first count elements (f.e. the 100 most recent entries),
+/// the order of the remaining elements is undefined
+///
+/// OnCompare: see Array_Sort
+///
+/// O(n log count)
+template <typename T, typename Func>
+instant void
+Array_PartialSort(
+	Array<T> &arr,
+	u64 count,
+	Func OnCompare
+) {
+	count = MIN(count, arr.count);
+
+	if (!count)
+		return;
+
+	_Array_IndexInvalidate(arr);
+
+	_Sort_HeapSelect(arr.memory, arr.memory + arr.count, count, OnCompare);
+}
+
+template <typename T>
+instant void
+Array_PartialSort(
+	Array<T> &arr,
+	u64 count,
+	SORT_ORDER_TYPE type
+) {
+	if (type == SORT_ORDER_ASCENDING)
+		Array_PartialSort(arr, count, [](T &one, T &two) { return (one < two); });
+	else
+	if (type == SORT_ORDER_DESCENDING)
+		Array_PartialSort(arr, count, [](T &one, T &two) { return (two < one); });
+	else
+		Assert(false);
+}
+
+/// copies the first count elements of the sort order into a_top_out
+/// (sorted), without changing the array
+///
+/// f.e. the 10 largest file sizes:
+///     Array_TopK(a_sizes, 10, a_largest, [](u64 one, u64 two) { return (one > two); });
+///
+/// O(n log count), a_top_out only holds count elements
+template <typename T, typename Func>
+instant void
+Array_TopK(
+	Array<T> &arr,
+	u64 count,
+	Array<T> &a_top_out,
+	Func OnCompare
+) {
+	Array_ClearContainer(a_top_out);
+
+	count = MIN(count, arr.count);
+
+	if (!count)
+		return;
+
+	Array_Reserve(a_top_out, count);
+
+	FOR(count, it) {
+		Array_Add(a_top_out, ARRAY_IT(arr, it));
+	}
+
+	_Array_IndexInvalidate(a_top_out);
+
+	T *heap = a_top_out.memory;
+
+	for(u64 it = count / 2; it > 0; --it)
+		_Sort_HeapSift(heap, it - 1, count, OnCompare);
+
+	FOR_START(count, arr.count, it) {
+		T &value = ARRAY_IT(arr, it);
+
+		if (_Sort_IsLess(OnCompare, value, heap[0])) {
+			heap[0] = value;
+			_Sort_HeapSift(heap, 0, count, OnCompare);
+		}
+	}
+
+	for(u64 it = count - 1; it > 0; --it) {
+		SWAP(T, &heap[0], &heap[it]);
+		_Sort_HeapSift(heap, 0, it, OnCompare);
+	}
 }
@@ -3,8 +3,13 @@
 #define String_Split Array_Split
 #define LOG std::cout
 
-/// set to 0 to disable it
-#define STRING_BUFFER_DEFAULT_SIZE	14
+/// owned strings up to this size are stored in slots of a shared
+/// memory pool instead of separate heap allocations
+/// (set to 0 to disable it)
+#define STRING_BUFFER_DEFAULT_SIZE	32
+
+/// pool slots allocated at once
+#define STRING_BUFFER_SLAB_COUNT	256
 
 enum STRING_LENGTH_TYPE {
 	STRING_LENGTH_BYTES,
@@ -20,7 +25,39 @@ struct String {
 	char *value  = 0;
 };
 
+#if STRING_BUFFER_DEFAULT_SIZE
+inline MemoryPool<char[STRING_BUFFER_DEFAULT_SIZE]> string_pool
+	= MemoryPool_Create<char[STRING_BUFFER_DEFAULT_SIZE]>(STRING_BUFFER_SLAB_COUNT, true);
+#endif
+
+/// storage for (at least) size bytes of an owned string,
+/// will move from a pool slot to the heap, when it grows too large
+/// file / line: call site for MEMORY_TRACKING
+instant char *
+_String_Reserve(
+	char *value,
+	u64 size,
+	const char *file = __builtin_FILE(),
+	u32 line = __builtin_LINE()
+) {
+#if STRING_BUFFER_DEFAULT_SIZE
+	if (size <= STRING_BUFFER_DEFAULT_SIZE) {
+		if (!value)
+			return (char *)MemoryPool_Alloc(string_pool);
+
+		if (    ((Memory_Header *)value - 1)->sig == MEMORY_SIGNATURE_POOL
+			AND size <= _MemoryPool_GetSlotSize(value)
+		) {
+			return value;
+		}
+	}
+#endif
+
+	return (char *)_Memory_Resize(value, size, file, line);
+}
+
 #include "utf8.h"
+#include "string_search.h"
 
 /// does support UTF-8
 constexpr
@@ -29,28 +66,34 @@ String_GetLength(
 	const char *c_data,
 	STRING_LENGTH_TYPE type = STRING_LENGTH_BYTES
 ) {
-	u64 result = 0;
-	u64 len_bytes = 0;
+	if (c_data == 0)
+		return 0;
+
+	const char *c_it = c_data;
 	u64 len_codepoints = 0;
 
-	if (c_data == 0)
-		return len_bytes;
+	/// stops at the terminator or the first invalid sequence
+	while(true) {
+		u64 count_ascii = _UTF8_CountASCII(c_it);
 
-	while (*c_data) {
-		s16 length_data = UTF8_GetByteCount(c_data);
+		c_it           += count_ascii;
+		len_codepoints += count_ascii;
 
-		if (length_data < 0)
+		if (!*c_it)
 			break;
 
-		c_data += length_data;
+		s16 length_data = UTF8_GetByteCount(c_it);
+
+		if (length_data < 0)
+			break;
 
-		len_bytes      += length_data;
+		c_it           += length_data;
 		len_codepoints += 1;
 	}
 
-	result = (type == STRING_LENGTH_BYTES ? len_bytes : len_codepoints);
+	u64 len_bytes = c_it - c_data;
 
-	return result;
+	return (type == STRING_LENGTH_BYTES ? len_bytes : len_codepoints);
 }
 
 constexpr
@@ -119,6 +162,36 @@ S(
 	return s_data_ref;
 }
 
+/// string literal with its length and (case-sensitive) hash
+/// fixed at compile-time, can be used like any other String
+///
+/// String_EndWith(s_word, "\n"_s, true)
+///
+/// @Note unlike S(), the length includes every byte of the
+///       literal (f.e. "\0"_s has a length of 1)
+struct StringLiteral : String {
+	u64 hash = 0;
+};
+
+consteval
+StringLiteral
+operator ""_s(
+	const char *c_data,
+	size_t length
+) {
+	StringLiteral s_literal;
+	{
+		s_literal.value  = (char *)c_data;
+		s_literal.length = length;
+		s_literal.hash   = Hash_Bytes(c_data, length);
+
+		s_literal.is_reference = true;
+		s_literal.has_changed  = true;
+	}
+
+	return s_literal;
+}
+
 instant void
 String_Print(
 	const String &s_data
@@ -235,7 +308,9 @@ String_Destroy(
 instant String
 String_Copy(
 	const char *c_source,
-	u32 length = 0
+	u32 length = 0,
+	const char *file = __builtin_FILE(),
+	u32 line = __builtin_LINE()
 ) {
 	Assert(c_source);
 
@@ -244,7 +319,7 @@ String_Copy(
 
 	String s_result = {};
 
-	s_result.value = Memory_Create(char, length);
+	s_result.value = _String_Reserve(nullptr, length, file, line);
 	Memory_Copy(s_result.value, c_source, length);
 	s_result.length = length;
 
@@ -258,14 +333,14 @@ constexpr
 instant void
 String_Resize(
 	String &s_data,
-	s64 new_length
+	s64 new_length,
+	const char *file = __builtin_FILE(),
+	u32 line = __builtin_LINE()
 ) {
 	Assert(new_length > 0);
 
-	if (new_length > (s64)s_data.length) {
-		char *t_value_old = s_data.value;
-		s_data.value = Memory_Resize(t_value_old, char, new_length);
-	}
+	if (new_length > (s64)s_data.length)
+		s_data.value = _String_Reserve(s_data.value, new_length, file, line);
 
 	s_data.length = new_length;
 }
@@ -275,7 +350,9 @@ instant bool
 String_Append(
 	String &s_data,
 	const String &s_source,
-	u64 length_append = 0
+	u64 length_append = 0,
+	const char *file = __builtin_FILE(),
+	u32 line = __builtin_LINE()
 ) {
     Assert(!s_data.is_reference);
 
@@ -290,7 +367,7 @@ String_Append(
 	Assert(length_append <= s_source.length);
 
 	u64 index_start = s_data.length;
-	String_Resize(s_data, s_data.length + length_append);
+	String_Resize(s_data, s_data.length + length_append, file, line);
 	Memory_Copy(s_data.value + index_start, s_source.value, length_append);
 
 	s_data.has_changed = true;
@@ -303,13 +380,15 @@ instant u64
 String_Insert(
 	String &s_data,
 	const String &s_source,
-	u64 index_start
+	u64 index_start,
+	const char *file = __builtin_FILE(),
+	u32 line = __builtin_LINE()
 ) {
 	Assert(!s_data.is_reference);
 
 	u64 dest_length_old = s_data.length;
 
-	String_Resize(s_data, s_data.length + s_source.length);
+	String_Resize(s_data, s_data.length + s_source.length, file, line);
 
 	Memory_Copy(s_data.value + index_start + s_source.length,
 				s_data.value + index_start,
@@ -341,9 +420,11 @@ instant void
 String_CreateBuffer(
 	String &s_buffer_out,
 	u64 buffer_size,
-	bool is_reference
+	bool is_reference,
+	const char *file = __builtin_FILE(),
+	u32 line = __builtin_LINE()
 ) {
-	String_Resize(s_buffer_out, buffer_size);
+	String_Resize(s_buffer_out, buffer_size, file, line);
 	s_buffer_out.length  = buffer_size;
 	s_buffer_out.has_changed = true;
 	s_buffer_out.is_reference = is_reference;
@@ -352,11 +433,13 @@ String_CreateBuffer(
 constexpr
 instant String
 String_CreateBuffer(
-	u64 buffer_size
+	u64 buffer_size,
+	const char *file = __builtin_FILE(),
+	u32 line = __builtin_LINE()
 ) {
 	String s_buffer_out = {};
 
-	String_Resize(s_buffer_out, buffer_size);
+	String_Resize(s_buffer_out, buffer_size, file, line);
 	s_buffer_out.length = buffer_size;
 	s_buffer_out.has_changed = true;
 
@@ -489,23 +572,27 @@ String_CopyBuffer(
 
 instant String
 String_Copy(
-	const String &s_data
+	const String &s_data,
+	const char *file = __builtin_FILE(),
+	u32 line = __builtin_LINE()
 ) {
-	return String_Copy(s_data.value, s_data.length);
+	return String_Copy(s_data.value, s_data.length, file, line);
 }
 
 instant char *
 String_CreateCBufferCopy(
 	const String &s_source,
-	MemoryArena *arena = nullptr
+	MemoryArena *arena = nullptr,
+	const char *file = __builtin_FILE(),
+	u32 line = __builtin_LINE()
 ) {
 	char *c_buffer = nullptr;
 
 	if (!arena) {
-        c_buffer = Memory_Create(char, s_source.length + 1);
+        c_buffer = (char *)_Memory_Alloc_Empty(s_source.length + 1, file, line);
 	}
 	else {
-        c_buffer = (char *)_Memory_Alloc_Empty(s_source.length + 1);
+        c_buffer = (char *)_Memory_Alloc_Empty(s_source.length + 1, file, line);
 	}
 
     Memory_Copy(c_buffer, s_source.value, s_source.length);
@@ -521,7 +608,7 @@ String_IndexOf(
 	s64 index_start_opt,
 	bool is_case_sensitive
 ) {
-	int result = -1;
+	s64 result = -1;
 
 	if (String_IsEmpty(s_data))
 		return result;
@@ -529,23 +616,20 @@ String_IndexOf(
 	if (String_IsEmpty(s_key, false))
 		return result;
 
-	u64 length_data = s_data.length;
-
 	if (index_start_opt < 0)
 		index_start_opt = 0;
 
-	FOR_START(index_start_opt, length_data, index) {
-		String s_data_ref = S(s_data);
-		String_AddOffset(s_data_ref, index);
+	if ((u64)index_start_opt >= s_data.length)
+		return result;
 
-		if (String_Compare(	s_data_ref,
-							s_key,
+	result = _String_Search(s_data.value  + index_start_opt,
+							s_data.length - index_start_opt,
+							s_key.value,
 							s_key.length,
-							is_case_sensitive) == 0
-		) {
-			return index;
-		}
-	}
+							is_case_sensitive);
+
+	if (result >= 0)
+		result += index_start_opt;
 
 	return result;
 }
@@ -896,7 +980,7 @@ String_RemoveLineBreaks(
 	Assert(!s_data.is_reference);
 
 	{ // "\r"
-		String s_find = S("\r");
+		String s_find = "\r"_s;
 
 		s64 index_found = 0;
 
@@ -906,7 +990,7 @@ String_RemoveLineBreaks(
 	}
 
 	{ // "\n"
-		String s_find = S("\n");
+		String s_find = "\n"_s;
 
 		s64 index_found = 0;
 
@@ -1049,7 +1133,7 @@ String_Insert(
 	else
 	if (c_data == '\r' OR c_data == '\n') {
 		length = 1;
- 		String_Insert(s_data, S("\n"), index_start);
+ 		String_Insert(s_data, "\n"_s, index_start);
 	}
 	else {
 		length = 1;
@@ -1122,12 +1206,14 @@ constexpr
 instant void
 String_Overwrite(
 	String &s_dest,
-	const String &s_source
+	const String &s_source,
+	const char *file = __builtin_FILE(),
+	u32 line = __builtin_LINE()
 ) {
 	String_Clear(s_dest);
 
 	if (!String_IsEmpty(s_source)) {
-        String_Append(s_dest, s_source);
+        String_Append(s_dest, s_source, 0, file, line);
 	}
 }
 
@@ -1157,6 +1243,23 @@ String_HasChanged(
 	return result;
 }
 
+/// @Important: hashes bytes (case-sensitive)
+constexpr
+instant u64
+Hash_Get(
+	const String &s_data
+) {
+	return Hash_Bytes(s_data.value, s_data.length);
+}
+
+constexpr
+instant u64
+Hash_Get(
+	const StringLiteral &s_data
+) {
+	return s_data.hash;
+}
+
 /// operator
 /// string - string
 constexpr
@@ -1233,6 +1336,29 @@ operator >= (
 	return !(s_data1 < s_data2);
 }
 
+/// literal - literal
+/// different hashes are rejected without reading the bytes
+constexpr
+bool
+operator == (
+	const StringLiteral &s_data1,
+	const StringLiteral &s_data2
+) {
+	if (s_data1.hash != s_data2.hash)
+		return false;
+
+	return String_IsEqual(s_data1, s_data2);
+}
+
+constexpr
+bool
+operator != (
+	const StringLiteral &s_data1,
+	const StringLiteral &s_data2
+) {
+	return !(s_data1 == s_data2);
+}
+
 /// string - const char *
 constexpr
 bool
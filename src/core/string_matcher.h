@@ -0,0 +1,288 @@
+#pragma once
+
+/// Searches for many keys at once (Aho-Corasick), so the data
+/// is scanned a single time, no matter how many keys there are.
+///
+/// StringMatcher matcher;
+/// StringMatcher_Create(matcher, as_keywords, false);
+///
+/// StringMatcher_Match match;
+/// if (StringMatcher_FindFirst(matcher, s_log, &match))
+///     ... ARRAY_IT(as_keywords, match.pattern) found at match.index
+///
+/// StringMatcher_Destroy(matcher);
+///
+/// The automaton is a complete state table: every state has one
+/// entry per byte class, so each input byte costs one lookup.
+/// Bytes, which are not part of any pattern, share class 0 and
+/// letters share their class when ignoring the case (ASCII only).
+
+/// set in a transition, when the target state (or a state in
+/// its fail chain) completes a pattern
+#define STRING_MATCHER_OUTPUT 0x80000000u
+
+struct StringMatcher {
+	/// [state << shift | class] -> (next_state << shift) | STRING_MATCHER_OUTPUT
+	u32 *transitions     = nullptr;
+	/// pattern completed by the state, -1 = none
+	s32 *outputs         = nullptr;
+	/// next state in the fail chain with an output, 0 = none
+	u32 *output_links    = nullptr;
+	u32 *pattern_lengths = nullptr;
+
+	u32  count_states    = 0;
+	u32  count_patterns  = 0;
+	u32  length_max      = 0;
+
+	/// row size is 1 << shift (>= class count)
+	u32  shift           = 0;
+	u8   classes[256]    = {};
+
+	bool is_case_sensitive = true;
+};
+
+struct StringMatcher_Match {
+	/// position of the first byte in the data
+	u64 index;
+	/// index into the patterns the matcher was created with
+	u32 pattern;
+};
+
+/// empty patterns never match, duplicates report the first index
+instant void
+StringMatcher_Create(
+	StringMatcher &matcher_out,
+	const Array<String> &as_patterns,
+	bool is_case_sensitive = true
+) {
+	matcher_out = {};
+	matcher_out.is_case_sensitive = is_case_sensitive;
+	matcher_out.count_patterns    = as_patterns.count;
+
+	/// byte classes, states are bound by the sum of pattern lengths
+	u32 count_classes    = 1;
+	u64 count_states_max = 1;
+
+	FOR_ARRAY(as_patterns, it) {
+		const String &s_pattern = ARRAY_IT(as_patterns, it);
+
+		FOR(s_pattern.length, it_char) {
+			u8 value = s_pattern.value[it_char];
+
+			if (!is_case_sensitive)
+				value = String_ToLower(value);
+
+			if (!matcher_out.classes[value]) {
+				matcher_out.classes[value] = count_classes;
+
+				if (!is_case_sensitive)
+					matcher_out.classes[(u8)String_ToUpper(value)] = count_classes;
+
+				++count_classes;
+			}
+		}
+
+		count_states_max += s_pattern.length;
+		matcher_out.length_max = MAX(matcher_out.length_max, (u32)s_pattern.length);
+	}
+
+	while((1u << matcher_out.shift) < count_classes)
+		++matcher_out.shift;
+
+	u32 shift = matcher_out.shift;
+	u32 *transitions = Memory_Create(u32, (count_states_max << shift));
+	s32 *outputs     = Memory_Create(s32, count_states_max);
+	u32 *fail_links  = Memory_Create(u32, count_states_max);
+
+	matcher_out.pattern_lengths = Memory_Create(u32, (as_patterns.count + 1));
+
+	outputs[0] = -1;
+	u32 count_states = 1;
+
+	/// trie: transitions hold state indices here,
+	/// 0 = no edge (root is never a target)
+	FOR_ARRAY(as_patterns, it) {
+		const String &s_pattern = ARRAY_IT(as_patterns, it);
+		matcher_out.pattern_lengths[it] = s_pattern.length;
+
+		if (!s_pattern.length)
+			continue;
+
+		u32 state = 0;
+
+		FOR(s_pattern.length, it_char) {
+			u32 &next = transitions[(state << shift) | matcher_out.classes[(u8)s_pattern.value[it_char]]];
+
+			if (!next) {
+				outputs[count_states] = -1;
+				next = count_states++;
+			}
+
+			state = next;
+		}
+
+		if (outputs[state] < 0)
+			outputs[state] = it;
+	}
+
+	u32 *output_links = Memory_Create(u32, count_states);
+
+	/// breadth first, so fail links and rows of shorter
+	/// prefixes are complete, before they get used
+	u32 *queue = Memory_Create(u32, count_states);
+	u32  queue_begin = 0;
+	u32  queue_end   = 1;
+
+	while(queue_begin < queue_end) {
+		u32 state = queue[queue_begin++];
+		u32 fail  = fail_links[state];
+
+		FOR(count_classes, it_class) {
+			u32 &next = transitions[(state << shift) | it_class];
+
+			if (next) {
+				u32 next_fail = (state) ? transitions[(fail << shift) | it_class] : 0;
+
+				fail_links[next]   = next_fail;
+				output_links[next] = (outputs[next_fail] >= 0) ? next_fail : output_links[next_fail];
+
+				queue[queue_end++] = next;
+			}
+			else {
+				next = (state) ? transitions[(fail << shift) | it_class] : 0;
+			}
+		}
+	}
+
+	/// state indices to row offsets, flagged when a pattern ends
+	FOR(count_states << shift, it) {
+		u32 next = transitions[it];
+
+		transitions[it] = next << shift;
+
+		if (outputs[next] >= 0 OR output_links[next])
+			transitions[it] |= STRING_MATCHER_OUTPUT;
+	}
+
+	Memory_Free(fail_links);
+	Memory_Free(queue);
+
+	matcher_out.transitions  = (u32 *)_Memory_Resize(transitions, (count_states << shift) * sizeof(u32));
+	matcher_out.outputs      = (s32 *)_Memory_Resize(outputs, count_states * sizeof(s32));
+	matcher_out.output_links = output_links;
+	matcher_out.count_states = count_states;
+}
+
+instant void
+StringMatcher_Destroy(
+	StringMatcher &matcher_out
+) {
+	Memory_Free(matcher_out.transitions);
+	Memory_Free(matcher_out.outputs);
+	Memory_Free(matcher_out.output_links);
+	Memory_Free(matcher_out.pattern_lengths);
+
+	matcher_out = {};
+}
+
+/// leftmost match, the lower pattern index wins
+/// when more patterns start at the same position
+instant bool
+StringMatcher_FindFirst(
+	const StringMatcher &matcher,
+	const String &s_data,
+	StringMatcher_Match *match_out,
+	u64 index_start = 0
+) {
+	Assert(match_out);
+
+	if (!matcher.transitions)
+		return false;
+
+	const u8 *data = (const u8 *)s_data.value;
+
+	u64 index_best   = (u64)-1;
+	u32 pattern_best = 0;
+	u32 row = 0;
+
+	FOR_START(index_start, s_data.length, it) {
+		/// following matches can not start before the current one
+		if (index_best != (u64)-1 AND it >= index_best + matcher.length_max)
+			break;
+
+		u32 next = matcher.transitions[row | matcher.classes[data[it]]];
+		row = next & ~STRING_MATCHER_OUTPUT;
+
+		if (!(next & STRING_MATCHER_OUTPUT))
+			continue;
+
+		u32 state = row >> matcher.shift;
+
+		if (matcher.outputs[state] < 0)
+			state = matcher.output_links[state];
+
+		while(state) {
+			u32 pattern = matcher.outputs[state];
+			u64 index   = it + 1 - matcher.pattern_lengths[pattern];
+
+			if (index < index_best OR (index == index_best AND pattern < pattern_best)) {
+				index_best   = index;
+				pattern_best = pattern;
+			}
+
+			state = matcher.output_links[state];
+		}
+	}
+
+	if (index_best == (u64)-1)
+		return false;
+
+	match_out->index   = index_best;
+	match_out->pattern = pattern_best;
+
+	return true;
+}
+
+/// appends every match (overlapping ones included),
+/// ordered by the position, where they end
+///
+/// returns the number of added matches
+instant u64
+StringMatcher_FindAll(
+	const StringMatcher &matcher,
+	const String &s_data,
+	Array<StringMatcher_Match> &a_matches_out
+) {
+	if (!matcher.transitions)
+		return 0;
+
+	const u8 *data = (const u8 *)s_data.value;
+
+	u64 count_before = a_matches_out.count;
+	u32 row = 0;
+
+	FOR(s_data.length, it) {
+		u32 next = matcher.transitions[row | matcher.classes[data[it]]];
+		row = next & ~STRING_MATCHER_OUTPUT;
+
+		if (!(next & STRING_MATCHER_OUTPUT))
+			continue;
+
+		u32 state = row >> matcher.shift;
+
+		if (matcher.outputs[state] < 0)
+			state = matcher.output_links[state];
+
+		while(state) {
+			StringMatcher_Match match;
+			match.pattern = matcher.outputs[state];
+			match.index   = it + 1 - matcher.pattern_lengths[match.pattern];
+
+			Array_Add(a_matches_out, match);
+
+			state = matcher.output_links[state];
+		}
+	}
+
+	return a_matches_out.count - count_before;
+}
@@ -0,0 +1,353 @@
+#pragma once
+
+/// Substring search used by String_IndexOf / String_Find.
+///
+/// short keys: SSE2 / AVX2 filter on the first and last byte of the key,
+///             only candidates, where both match, get compared
+/// long keys:  Two-Way (Crochemore-Perrin), linear in the worst case,
+///             with a last byte shift table to skip ahead
+///
+/// Case-insensitive search folds ASCII only (same as String_ToLower).
+
+/// keys with at least this length use Two-Way
+#define STRING_SEARCH_TWOWAY_MIN 32
+
+constexpr
+instant u8
+_String_SearchFold(
+	u8 value,
+	bool is_case_sensitive
+) {
+	if (!is_case_sensitive AND value >= 'A' AND value <= 'Z')
+		return value + 32;
+
+	return value;
+}
+
+/// counterpart of a folded letter
+constexpr
+instant u8
+_String_SearchUpper(
+	u8 value
+) {
+	if (value >= 'a' AND value <= 'z')
+		return value - 32;
+
+	return value;
+}
+
+constexpr
+instant bool
+_String_SearchIsEqual(
+	const u8 *data,
+	const u8 *key,
+	u64 length,
+	bool is_case_sensitive
+) {
+	FOR(length, it) {
+		if (_String_SearchFold(data[it], is_case_sensitive) != _String_SearchFold(key[it], is_case_sensitive))
+			return false;
+	}
+
+	return true;
+}
+
+constexpr
+instant s64
+_String_SearchScalar(
+	const u8 *data,
+	u64 length_data,
+	const u8 *key,
+	u64 length_key,
+	bool is_case_sensitive
+) {
+	u8 key_first = _String_SearchFold(key[0]             , is_case_sensitive);
+	u8 key_last  = _String_SearchFold(key[length_key - 1], is_case_sensitive);
+
+	FOR(length_data - length_key + 1, it) {
+		if (    _String_SearchFold(data[it]                 , is_case_sensitive) == key_first
+			AND _String_SearchFold(data[it + length_key - 1], is_case_sensitive) == key_last
+			AND _String_SearchIsEqual(data + it + 1, key + 1, length_key - MIN(length_key, (u64)2), is_case_sensitive)
+		) {
+			return it;
+		}
+	}
+
+	return -1;
+}
+
+__attribute__((target("sse2")))
+instant s64
+_String_SearchSSE2(
+	const u8 *data,
+	u64 length_data,
+	const u8 *key,
+	u64 length_key,
+	bool is_case_sensitive
+) {
+	constexpr u64 block = sizeof(__m128i);
+
+	u8 key_first = _String_SearchFold(key[0]             , is_case_sensitive);
+	u8 key_last  = _String_SearchFold(key[length_key - 1], is_case_sensitive);
+
+	/// without case, the upper case letter is tested as well
+	__m128i first_lower = _mm_set1_epi8(key_first);
+	__m128i last_lower  = _mm_set1_epi8(key_last);
+	__m128i first_upper = _mm_set1_epi8(_String_SearchUpper(key_first));
+	__m128i last_upper  = _mm_set1_epi8(_String_SearchUpper(key_last));
+
+	u64 length_middle = length_key - MIN(length_key, (u64)2);
+
+	u64 it = 0;
+
+	for(; it + length_key - 1 + block <= length_data; it += block) {
+		__m128i data_first = _mm_loadu_si128((const __m128i *)(data + it));
+		__m128i data_last  = _mm_loadu_si128((const __m128i *)(data + it + length_key - 1));
+
+		__m128i is_first = _mm_cmpeq_epi8(data_first, first_lower);
+		__m128i is_last  = _mm_cmpeq_epi8(data_last , last_lower);
+
+		if (!is_case_sensitive) {
+			is_first = _mm_or_si128(is_first, _mm_cmpeq_epi8(data_first, first_upper));
+			is_last  = _mm_or_si128(is_last , _mm_cmpeq_epi8(data_last , last_upper));
+		}
+
+		u32 mask = _mm_movemask_epi8(_mm_and_si128(is_first, is_last));
+
+		while(mask) {
+			u64 index = it + __builtin_ctz(mask);
+
+			if (_String_SearchIsEqual(data + index + 1, key + 1, length_middle, is_case_sensitive))
+				return index;
+
+			mask &= mask - 1;
+		}
+	}
+
+	s64 result = _String_SearchScalar(data + it, length_data - it, key, length_key, is_case_sensitive);
+
+	return (result < 0) ? result : (s64)it + result;
+}
+
+__attribute__((target("avx2")))
+instant s64
+_String_SearchAVX2(
+	const u8 *data,
+	u64 length_data,
+	const u8 *key,
+	u64 length_key,
+	bool is_case_sensitive
+) {
+	constexpr u64 block = sizeof(__m256i);
+
+	u8 key_first = _String_SearchFold(key[0]             , is_case_sensitive);
+	u8 key_last  = _String_SearchFold(key[length_key - 1], is_case_sensitive);
+
+	/// without case, the upper case letter is tested as well
+	__m256i first_lower = _mm256_set1_epi8(key_first);
+	__m256i last_lower  = _mm256_set1_epi8(key_last);
+	__m256i first_upper = _mm256_set1_epi8(_String_SearchUpper(key_first));
+	__m256i last_upper  = _mm256_set1_epi8(_String_SearchUpper(key_last));
+
+	u64 length_middle = length_key - MIN(length_key, (u64)2);
+
+	u64 it = 0;
+
+	for(; it + length_key - 1 + block <= length_data; it += block) {
+		__m256i data_first = _mm256_loadu_si256((const __m256i *)(data + it));
+		__m256i data_last  = _mm256_loadu_si256((const __m256i *)(data + it + length_key - 1));
+
+		__m256i is_first = _mm256_cmpeq_epi8(data_first, first_lower);
+		__m256i is_last  = _mm256_cmpeq_epi8(data_last , last_lower);
+
+		if (!is_case_sensitive) {
+			is_first = _mm256_or_si256(is_first, _mm256_cmpeq_epi8(data_first, first_upper));
+			is_last  = _mm256_or_si256(is_last , _mm256_cmpeq_epi8(data_last , last_upper));
+		}
+
+		u32 mask = _mm256_movemask_epi8(_mm256_and_si256(is_first, is_last));
+
+		while(mask) {
+			u64 index = it + __builtin_ctz(mask);
+
+			if (_String_SearchIsEqual(data + index + 1, key + 1, length_middle, is_case_sensitive))
+				return index;
+
+			mask &= mask - 1;
+		}
+	}
+
+	s64 result = _String_SearchScalar(data + it, length_data - it, key, length_key, is_case_sensitive);
+
+	return (result < 0) ? result : (s64)it + result;
+}
+
+/// splits the key into key[0..ms] and key[ms+1..] (critical factorization)
+/// by its maximal suffix, with '>' or '<' as order of bytes
+///
+/// returns ms (or -1 as u64) and the period of the suffix in period_out
+constexpr
+instant u64
+_String_SearchMaxSuffix(
+	const u8 *key,
+	u64 length_key,
+	bool is_case_sensitive,
+	bool is_reversed,
+	u64 *period_out
+) {
+	u64 index     = (u64)-1;
+	u64 index_cmp = 0;
+	u64 offset    = 1;
+	u64 period    = 1;
+
+	while(index_cmp + offset < length_key) {
+		u8 value     = _String_SearchFold(key[index + offset]    , is_case_sensitive);
+		u8 value_cmp = _String_SearchFold(key[index_cmp + offset], is_case_sensitive);
+
+		if (value == value_cmp) {
+			if (offset == period) {
+				index_cmp += period;
+				offset = 1;
+			}
+			else {
+				++offset;
+			}
+		}
+		else
+		if ((value > value_cmp) != is_reversed) {
+			index_cmp += offset;
+			offset = 1;
+			period = index_cmp - index;
+		}
+		else {
+			index = index_cmp++;
+			offset = period = 1;
+		}
+	}
+
+	*period_out = period;
+
+	return index;
+}
+
+constexpr
+instant s64
+_String_SearchTwoWay(
+	const u8 *data,
+	u64 length_data,
+	const u8 *key,
+	u64 length_key,
+	bool is_case_sensitive
+) {
+	/// last position of a byte in the key + 1,
+	/// 0 = not part of the key
+	u64 shift[256] = {};
+
+	FOR(length_key, it) {
+		u8 value = _String_SearchFold(key[it], is_case_sensitive);
+
+		shift[value] = it + 1;
+
+		if (!is_case_sensitive)
+			shift[_String_SearchUpper(value)] = it + 1;
+	}
+
+	u64 period_1;
+	u64 period_2;
+	u64 ms_1 = _String_SearchMaxSuffix(key, length_key, is_case_sensitive, false, &period_1);
+	u64 ms_2 = _String_SearchMaxSuffix(key, length_key, is_case_sensitive, true , &period_2);
+
+	u64 ms     = ms_1;
+	u64 period = period_1;
+
+	if (ms_2 + 1 > ms_1 + 1) {
+		ms     = ms_2;
+		period = period_2;
+	}
+
+	/// periodic key: after a shift by period, the already
+	/// matched prefix (memory) does not need to be compared again
+	u64 memory_periodic = 0;
+
+	if (!_String_SearchIsEqual(key, key + period, ms + 1, is_case_sensitive))
+		period = MAX(ms, length_key - ms - 1) + 1;
+	else
+		memory_periodic = length_key - period;
+
+	u64 memory = 0;
+	u64 pos    = 0;
+
+	while(pos + length_key <= length_data) {
+		const u8 *window = data + pos;
+
+		u64 shift_last = shift[window[length_key - 1]];
+
+		if (!shift_last) {
+			pos += length_key;
+			memory = 0;
+			continue;
+		}
+
+		if (shift_last != length_key) {
+			pos += MAX(length_key - shift_last, memory);
+			memory = 0;
+			continue;
+		}
+
+		/// right half
+		u64 it = MAX(ms + 1, memory);
+
+		while(it < length_key AND _String_SearchFold(window[it], is_case_sensitive) == _String_SearchFold(key[it], is_case_sensitive))
+			++it;
+
+		if (it < length_key) {
+			pos += it - ms;
+			memory = 0;
+			continue;
+		}
+
+		/// left half
+		it = ms + 1;
+
+		while(it > memory AND _String_SearchFold(window[it - 1], is_case_sensitive) == _String_SearchFold(key[it - 1], is_case_sensitive))
+			--it;
+
+		if (it <= memory)
+			return pos;
+
+		pos += period;
+		memory = memory_periodic;
+	}
+
+	return -1;
+}
+
+constexpr
+instant s64
+_String_Search(
+	const char *c_data,
+	u64 length_data,
+	const char *c_key,
+	u64 length_key,
+	bool is_case_sensitive
+) {
+	if (!length_key OR length_key > length_data)
+		return -1;
+
+	const u8 *data = (const u8 *)c_data;
+	const u8 *key  = (const u8 *)c_key;
+
+	if (length_key >= STRING_SEARCH_TWOWAY_MIN)
+		return _String_SearchTwoWay(data, length_data, key, length_key, is_case_sensitive);
+
+	switch (memory_simd) {
+		case MEMORY_SIMD_AVX2:
+			return _String_SearchAVX2(data, length_data, key, length_key, is_case_sensitive);
+
+		case MEMORY_SIMD_SSE2:
+			return _String_SearchSSE2(data, length_data, key, length_key, is_case_sensitive);
+
+		default:
+			return _String_SearchScalar(data, length_data, key, length_key, is_case_sensitive);
+	}
+}
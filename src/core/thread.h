@@ -58,3 +58,26 @@ Thread_WaitFor(
 
 	WaitForMultipleObjects(1, &thread->handle, TRUE, INFINITE);
 }
+
+/// closes the handle, the thread has to be finished
+instant void
+Thread_Destroy(
+	Thread *thread_io
+) {
+	Assert(thread_io);
+
+	if (thread_io->handle)
+		CloseHandle(thread_io->handle);
+
+	*thread_io = {};
+}
+
+/// logical processors of the system
+instant u64
+Thread_GetProcessorCount(
+) {
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+
+	return MAX((u64)info.dwNumberOfProcessors, (u64)1);
+}
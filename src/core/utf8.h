@@ -1,85 +1,686 @@
 #pragma once
 
+/// UTF-8 decoding, validation and counting.
+///
+/// ASCII runs are handled 16 (SSE2) or 32 (AVX2) bytes at a time,
+/// see memory_simd. UTF8_IsValid uses the lookup based validation
+/// by Keiser and Lemire with AVX2 (SSE2 has no byte shuffle, so it
+/// only skips ASCII blocks there).
+
+#define UTF8_CODEPOINT_MAX 0x10FFFF
+
+/// bytes of a sequence by the upper 5 bits of its lead byte,
+/// 0 = continuation byte or invalid lead byte
+constexpr u8 utf8_sequence_lengths[32] = {
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2,
+	3, 3,
+	4,
+	0
+};
+
+/// decodes a single codepoint and rejects overlong encodings,
+/// surrogates (U+D800 to U+DFFF) and everything above U+10FFFF
+///
+/// stops reading at the first byte, which does not fit,
+/// so it is safe to use with zero terminated data
+///
+/// returns the amount of bytes (1-4) or -1 when invalid
 constexpr
-instant s16
-UTF8_GetByteCount(
-	const char *ch
+instant s32
+_UTF8_Decode(
+	const char *c_data,
+	u64 length,
+	u32 *codepoint_out
 ) {
-	/// amount of bytes used for a UTF-8 encoded character
-	u8 utf_char_count = 0;
+	if (!length)
+		return -1;
+
+	u32 lead = (u8)c_data[0];
+
+	if (lead < 0x80) {
+		*codepoint_out = lead;
+		return 1;
+	}
+
+	u64 count = utf8_sequence_lengths[lead >> 3];
+
+	if (count < 2 OR count > length)
+		return -1;
+
+	u32 codepoint = lead & (0x7F >> count);
 
-	     if (*ch == 0xED AND (ch[1] & 0xA0) == 0x0)  return -1; /// U+d800 to U+dfff
-	else if (0x00 <= *ch AND *ch < 0x80) 	utf_char_count = 1;	/// 0bbbbbbb
-	else if ((*ch & 0xE0) == 0xC0) 			utf_char_count = 2; /// 110bbbbb
-	else if ((*ch & 0xF0) == 0xE0) 			utf_char_count = 3; /// 1110bbbb
-	else if ((*ch & 0xF8) == 0xF0) 			utf_char_count = 4; /// 11110bbb
-	else { return -1; };
+	FOR_START(1, count, it) {
+		u8 value = c_data[it];
 
-	/// integrity check
-	FOR((u64)utf_char_count - 1, it) {
-		if ((ch[++it] & 0xC0) != 0x80)
+		if ((value & 0xC0) != 0x80)
 			return -1;
+
+		codepoint = (codepoint << 6) | (value & 0x3F);
+	}
+
+	/// smallest codepoint per sequence length, anything below is overlong
+	constexpr u32 codepoint_min[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+
+	if (    codepoint < codepoint_min[count]
+		OR  codepoint > UTF8_CODEPOINT_MAX
+		OR (codepoint >= 0xD800 AND codepoint <= 0xDFFF)
+	) {
+		return -1;
 	}
 
-	return utf_char_count;
+	*codepoint_out = codepoint;
+
+	return count;
 }
 
+/// amount of bytes used for the UTF-8 encoded character, -1 = invalid
+constexpr
+instant s16
+UTF8_GetByteCount(
+	const char *ch
+) {
+	u32 codepoint = 0;
+
+	return _UTF8_Decode(ch, 4, &codepoint);
+}
+
+/// when s_data starts inside of a sequence, the codepoint it belongs to
+/// gets decoded and utf_byte_count only counts the bytes from s_data on
+///
+/// invalid bytes are returned as they are, with a byte count of 1
 constexpr
 instant s32
 UTF8_ToCodepoint(
 	const String &s_data,
 	s32 *utf_byte_count = 0
 ) {
-    if (utf_byte_count)
-		*utf_byte_count = 1;
+	const u8 *data = (const u8 *)s_data.value;
 
-	s32 it   = 0;
-	s32 code = (u8)s_data.value[it];
+	if (utf_byte_count)
+		*utf_byte_count = 1;
 
 	/// ascii
-    if (code < 0x80)
-		return code;
+	if (data[0] < 0x80)
+		return data[0];
+
+	s32 offset = 0;
+
+	while(offset < 3 AND (data[-offset] & 0xC0) == 0x80)
+		++offset;
+
+	u32 codepoint = 0;
+	s32 count = _UTF8_Decode(s_data.value - offset, s_data.length + offset, &codepoint);
+
+	if (count <= offset)
+		return data[0];
+
+	if (utf_byte_count)
+		*utf_byte_count = count - offset;
+
+	return codepoint;
+}
 
-    /// bits after identifier
-    const int bit_remain = 6;
+/// ::: ASCII runs (zero terminated)
+/// ===========================================================================
+/// aligned loads never cross a page boundary, so reading past the
+/// terminator within the same block is safe (but unknown to ASan)
+__attribute__((target("sse2"), no_sanitize_address))
+instant u64
+_UTF8_CountASCIISSE2(
+	const u8 *data
+) {
+	constexpr u64 block = sizeof(__m128i);
+
+	u64 count = 0;
+
+	while((u64)(data + count) % block) {
+		if (!data[count] OR data[count] >= 0x80)
+			return count;
+
+		++count;
+	}
+
+	__m128i zero = _mm_setzero_si128();
 
-	int bit_mask  = (1 << bit_remain) - 1;
-    int bit_shift = 0;
-    int bit_count = 0;
+	while(true) {
+		__m128i input = _mm_load_si128((const __m128i *)(data + count));
+		u32 mask = _mm_movemask_epi8(input) | _mm_movemask_epi8(_mm_cmpeq_epi8(input, zero));
 
-	s32 codepoint = 0;
+		if (mask)
+			return count + __builtin_ctz(mask);
 
-	u64 it_rev = 0;
+		count += block;
+	}
+}
+
+__attribute__((target("avx2"), no_sanitize_address))
+instant u64
+_UTF8_CountASCIIAVX2(
+	const u8 *data
+) {
+	constexpr u64 block = sizeof(__m256i);
+
+	u64 count = 0;
 
-	FOR(3, it_rev) {
-		/// check 11000000 identifier
-		while((code & 0xC0) == 0xC0) {
-			/// remove the leading '1' to check for '11' in the next iteration
-			code <<= 1;
-			code &= 0xff;
+	while((u64)(data + count) % block) {
+		if (!data[count] OR data[count] >= 0x80)
+			return count;
 
-			bit_count += bit_remain;
-			bit_mask >>= 1;
-			++bit_shift;
+		++count;
+	}
 
-			codepoint <<= bit_remain;
-			codepoint |= s_data.value[++it - it_rev] & ((1 << bit_remain) - 1);
+	__m256i zero = _mm256_setzero_si256();
 
-			if (utf_byte_count)
-				*utf_byte_count += 1;
+	while(true) {
+		__m256i input = _mm256_load_si256((const __m256i *)(data + count));
+		u32 mask = _mm256_movemask_epi8(input) | _mm256_movemask_epi8(_mm256_cmpeq_epi8(input, zero));
+
+		if (mask)
+			return count + __builtin_ctz(mask);
+
+		count += block;
+	}
+}
+
+/// amount of ASCII bytes before the first non-ASCII byte or terminator
+constexpr
+instant u64
+_UTF8_CountASCII(
+	const char *c_data
+) {
+	/// still used in constant expressions, f.e. S("...") for a hash
+	if (!std::is_constant_evaluated()) {
+		switch (memory_simd) {
+			case MEMORY_SIMD_AVX2:
+				return _UTF8_CountASCIIAVX2((const u8 *)c_data);
+
+			case MEMORY_SIMD_SSE2:
+				return _UTF8_CountASCIISSE2((const u8 *)c_data);
+
+			default:
+				break;
+		}
+	}
+
+	u64 count = 0;
+
+	while(c_data[count] AND (u8)c_data[count] < 0x80)
+		++count;
+
+	return count;
+}
+
+/// ::: Validation
+/// ===========================================================================
+instant bool
+_UTF8_IsValidScalar(
+	const u8 *data,
+	u64 length,
+	u64 *index_invalid_out
+) {
+	u64 it = 0;
+
+	while(it < length) {
+		u32 codepoint;
+		s32 count = _UTF8_Decode((const char *)data + it, length - it, &codepoint);
+
+		if (count < 0) {
+			*index_invalid_out = it;
+			return false;
 		}
 
-		if (*utf_byte_count > 1)
+		it += count;
+	}
+
+	return true;
+}
+
+/// returns the index to continue with the scalar validation:
+/// length when everything is ASCII, otherwise the first non-ASCII byte
+__attribute__((target("sse2")))
+instant u64
+_UTF8_SkipASCIISSE2(
+	const u8 *data,
+	u64 length
+) {
+	constexpr u64 block = sizeof(__m128i);
+
+	u64 it = 0;
+
+	for(; it + block <= length; it += block) {
+		u32 mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(data + it)));
+
+		if (mask)
+			return it + __builtin_ctz(mask);
+	}
+
+	while(it < length AND data[it] < 0x80)
+		++it;
+
+	return it;
+}
+
+/// error flags per byte pair (lead / previous byte, current byte)
+#define UTF8_TOO_SHORT		(1 << 0)	/// 11______ 0_______, 11______ 11______
+#define UTF8_TOO_LONG		(1 << 1)	/// 0_______ 10______
+#define UTF8_OVERLONG_3		(1 << 2)	/// 11100000 100_____
+#define UTF8_TOO_LARGE		(1 << 3)	/// 11110100 1001____ (and above)
+#define UTF8_SURROGATE		(1 << 4)	/// 11101101 101_____
+#define UTF8_OVERLONG_2		(1 << 5)	/// 1100000_ 10______
+#define UTF8_TOO_LARGE_1000	(1 << 6)	/// 11110101 1000____ (and above)
+#define UTF8_OVERLONG_4		(1 << 6)	/// 11110000 1000____
+#define UTF8_TWO_CONTS		(1 << 7)	/// 10______ 10______
+#define UTF8_CARRY			(UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+/// errors of a 32 byte block, input_prev is the block before it
+__attribute__((target("avx2")))
+instant __m256i
+_UTF8_CheckBlockAVX2(
+	__m256i input,
+	__m256i input_prev
+) {
+	__m256i mask_low = _mm256_set1_epi8(0x0F);
+
+	/// bytes 1, 2 and 3 positions before every byte of input
+	__m256i lanes = _mm256_permute2x128_si256(input_prev, input, 0x21);
+	__m256i prev_1 = _mm256_alignr_epi8(input, lanes, 15);
+	__m256i prev_2 = _mm256_alignr_epi8(input, lanes, 14);
+	__m256i prev_3 = _mm256_alignr_epi8(input, lanes, 13);
+
+	__m256i table_1_high = _mm256_setr_epi8(
+		/// 0_______ ________ (ascii)
+		UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+		UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+		/// 10______ ________ (continuation)
+		UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+		/// 1100____, 1101____, 1110____, 1111____
+		UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+		UTF8_TOO_SHORT,
+		UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+		UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+
+		UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+		UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+		UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+		UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+		UTF8_TOO_SHORT,
+		UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+		UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4
+	);
+
+	__m256i table_1_low = _mm256_setr_epi8(
+		/// ____0000, ____0001, ____001_
+		UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+		UTF8_CARRY | UTF8_OVERLONG_2,
+		UTF8_CARRY,
+		UTF8_CARRY,
+		/// ____0100, ____0101, ____011_
+		UTF8_CARRY | UTF8_TOO_LARGE,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		/// ____1___, ____1101 (surrogate)
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+
+		UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+		UTF8_CARRY | UTF8_OVERLONG_2,
+		UTF8_CARRY,
+		UTF8_CARRY,
+		UTF8_CARRY | UTF8_TOO_LARGE,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+		UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000
+	);
+
+	__m256i table_2_high = _mm256_setr_epi8(
+		/// ________ 0_______ (ascii)
+		UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+		UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+		/// ________ 1000____, 1001____, 101_____
+		UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+		UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+		UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE  | UTF8_TOO_LARGE,
+		UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE  | UTF8_TOO_LARGE,
+		/// ________ 11______
+		UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+
+		UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+		UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+		UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+		UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+		UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE  | UTF8_TOO_LARGE,
+		UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE  | UTF8_TOO_LARGE,
+		UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT
+	);
+
+	__m256i byte_1_high = _mm256_shuffle_epi8(table_1_high, _mm256_and_si256(_mm256_srli_epi16(prev_1, 4), mask_low));
+	__m256i byte_1_low  = _mm256_shuffle_epi8(table_1_low , _mm256_and_si256(prev_1, mask_low));
+	__m256i byte_2_high = _mm256_shuffle_epi8(table_2_high, _mm256_and_si256(_mm256_srli_epi16(input, 4), mask_low));
+
+	__m256i special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+	/// 3rd and 4th byte of a sequence have to be continuation bytes,
+	/// only 111_____ / 1111____ end up with the high bit set
+	__m256i is_third  = _mm256_subs_epu8(prev_2, _mm256_set1_epi8(0xE0 - 0x80));
+	__m256i is_fourth = _mm256_subs_epu8(prev_3, _mm256_set1_epi8(0xF0 - 0x80));
+	__m256i must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third, is_fourth), _mm256_set1_epi8((char)0x80));
+
+	return _mm256_xor_si256(must_be_continuation, special_cases);
+}
+
+/// returns the index to continue with the scalar validation
+/// (before the block with the error) or length when valid
+__attribute__((target("avx2")))
+instant u64
+_UTF8_CheckAVX2(
+	const u8 *data,
+	u64 length
+) {
+	constexpr u64 block = sizeof(__m256i);
+
+	/// sequence started at the end of the block, which is not complete
+	__m256i incomplete_max = _mm256_setr_epi8(
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+	);
+
+	__m256i input_prev = _mm256_setzero_si256();
+	__m256i incomplete = _mm256_setzero_si256();
+
+	u64 it = 0;
+
+	for(; it + block <= length; it += block) {
+		__m256i input = _mm256_loadu_si256((const __m256i *)(data + it));
+		__m256i error = incomplete;
+
+		if (_mm256_movemask_epi8(input)) {
+			error      = _UTF8_CheckBlockAVX2(input, input_prev);
+			incomplete = _mm256_subs_epu8(input, incomplete_max);
+		}
+
+		if (!_mm256_testz_si256(error, error))
+			return (it) ? it - block : 0;
+
+		input_prev = input;
+	}
+
+	/// the rest gets padded with zeros (ascii), which also
+	/// reveals a sequence, that is cut off at the end
+	u8 buffer[block] = {};
+	Memory_Copy(buffer, data + it, length - it);
+
+	__m256i error = _UTF8_CheckBlockAVX2(_mm256_loadu_si256((const __m256i *)buffer), input_prev);
+
+	if (!_mm256_testz_si256(error, error))
+		return (it) ? it - block : 0;
+
+	return length;
+}
+
+/// index_invalid_out: first byte of the invalid sequence
+instant bool
+UTF8_IsValid(
+	const String &s_data,
+	u64 *index_invalid_out = 0
+) {
+	const u8 *data = (const u8 *)s_data.value;
+	u64 length = s_data.length;
+	u64 index_start = 0;
+
+	switch (memory_simd) {
+		case MEMORY_SIMD_AVX2: {
+			index_start = _UTF8_CheckAVX2(data, length);
+		} break;
+
+		case MEMORY_SIMD_SSE2: {
+			index_start = _UTF8_SkipASCIISSE2(data, length);
+		} break;
+
+		default: {
+		} break;
+	}
+
+	if (index_start >= length)
+		return true;
+
+	/// step back to the start of the sequence
+	u64 count_back = 0;
+
+	while(index_start AND count_back < 3 AND (data[index_start] & 0xC0) == 0x80) {
+		--index_start;
+		++count_back;
+	}
+
+	u64 t_index_invalid = 0;
+
+	if (_UTF8_IsValidScalar(data + index_start, length - index_start, &t_index_invalid))
+		return true;
+
+	if (index_invalid_out)
+		*index_invalid_out = index_start + t_index_invalid;
+
+	return false;
+}
+
+/// ::: Counting
+/// ===========================================================================
+__attribute__((target("sse2")))
+instant u64
+_UTF8_CountLeadBytesSSE2(
+	const u8 *data,
+	u64 length
+) {
+	constexpr u64 block = sizeof(__m128i);
+
+	/// 0x80 - 0xBF are -128 to -65 as signed bytes
+	__m128i continuation_max = _mm_set1_epi8(-65);
+
+	u64 result = 0;
+	u64 it = 0;
+
+	for(; it + block <= length; it += block) {
+		__m128i input = _mm_loadu_si128((const __m128i *)(data + it));
+		result += __builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(input, continuation_max)));
+	}
+
+	for(; it < length; ++it)
+		result += ((data[it] & 0xC0) != 0x80);
+
+	return result;
+}
+
+__attribute__((target("avx2")))
+instant u64
+_UTF8_CountLeadBytesAVX2(
+	const u8 *data,
+	u64 length
+) {
+	constexpr u64 block = sizeof(__m256i);
+
+	__m256i continuation_max = _mm256_set1_epi8(-65);
+
+	u64 result = 0;
+	u64 it = 0;
+
+	for(; it + block <= length; it += block) {
+		__m256i input = _mm256_loadu_si256((const __m256i *)(data + it));
+		result += __builtin_popcount(_mm256_movemask_epi8(_mm256_cmpgt_epi8(input, continuation_max)));
+	}
+
+	for(; it < length; ++it)
+		result += ((data[it] & 0xC0) != 0x80);
+
+	return result;
+}
+
+/// amount of codepoints in valid UTF-8 data
+/// (counts every byte, which is not a continuation byte)
+instant u64
+UTF8_GetCodepointCount(
+	const String &s_data
+) {
+	const u8 *data = (const u8 *)s_data.value;
+
+	switch (memory_simd) {
+		case MEMORY_SIMD_AVX2:
+			return _UTF8_CountLeadBytesAVX2(data, s_data.length);
+
+		case MEMORY_SIMD_SSE2:
+			return _UTF8_CountLeadBytesSSE2(data, s_data.length);
+
+		default: {
+			u64 result = 0;
+
+			FOR(s_data.length, it) {
+				result += ((data[it] & 0xC0) != 0x80);
+			}
+
+			return result;
+		}
+	}
+}
+
+/// ::: Bulk decoding
+/// ===========================================================================
+/// ascii bytes before the first non-ascii byte are widened in place,
+/// 16 at a time (returns the amount of bytes done)
+__attribute__((target("sse2")))
+instant u64
+_UTF8_WidenASCIISSE2(
+	const u8 *data,
+	u64 length,
+	u32 *codepoints_out
+) {
+	constexpr u64 block = sizeof(__m128i);
+
+	__m128i zero = _mm_setzero_si128();
+
+	u64 it = 0;
+
+	for(; it + block <= length; it += block) {
+		__m128i input = _mm_loadu_si128((const __m128i *)(data + it));
+
+		if (_mm_movemask_epi8(input))
 			break;
 
-		code = (u8)s_data.value[--it];
+		__m128i words_low  = _mm_unpacklo_epi8(input, zero);
+		__m128i words_high = _mm_unpackhi_epi8(input, zero);
 
+		_mm_storeu_si128((__m128i *)(codepoints_out + it) + 0, _mm_unpacklo_epi16(words_low , zero));
+		_mm_storeu_si128((__m128i *)(codepoints_out + it) + 1, _mm_unpackhi_epi16(words_low , zero));
+		_mm_storeu_si128((__m128i *)(codepoints_out + it) + 2, _mm_unpacklo_epi16(words_high, zero));
+		_mm_storeu_si128((__m128i *)(codepoints_out + it) + 3, _mm_unpackhi_epi16(words_high, zero));
 	}
 
-	if (utf_byte_count)
-		*utf_byte_count = -((s64)it_rev) + *utf_byte_count;
+	return it;
+}
+
+__attribute__((target("avx2")))
+instant u64
+_UTF8_WidenASCIIAVX2(
+	const u8 *data,
+	u64 length,
+	u32 *codepoints_out
+) {
+	constexpr u64 block = sizeof(__m256i);
+
+	u64 it = 0;
+
+	for(; it + block <= length; it += block) {
+		__m256i input = _mm256_loadu_si256((const __m256i *)(data + it));
+
+		if (_mm256_movemask_epi8(input))
+			break;
+
+		__m128i input_low  = _mm256_castsi256_si128(input);
+		__m128i input_high = _mm256_extracti128_si256(input, 1);
+
+		_mm256_storeu_si256((__m256i *)(codepoints_out + it) + 0, _mm256_cvtepu8_epi32(input_low));
+		_mm256_storeu_si256((__m256i *)(codepoints_out + it) + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(input_low , 8)));
+		_mm256_storeu_si256((__m256i *)(codepoints_out + it) + 2, _mm256_cvtepu8_epi32(input_high));
+		_mm256_storeu_si256((__m256i *)(codepoints_out + it) + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(input_high, 8)));
+	}
+
+	return it;
+}
+
+/// decodes s_data into codepoints_out, which needs space for
+/// s_data.length codepoints (one per byte in the worst case)
+///
+/// stops at the first invalid sequence,
+/// length_decoded_out: amount of bytes, that got decoded
+///
+/// returns the amount of codepoints
+instant u64
+UTF8_Decode(
+	const String &s_data,
+	u32 *codepoints_out,
+	u64 *length_decoded_out = 0
+) {
+	Assert(codepoints_out);
+
+	const u8 *data = (const u8 *)s_data.value;
+	u64 length = s_data.length;
+
+	u64 count = 0;
+	u64 it = 0;
+
+	while(it < length) {
+		/// ascii run, the output position is behind the input position
+		/// by the amount of continuation bytes so far
+		u64 count_ascii = 0;
+
+		switch (memory_simd) {
+			case MEMORY_SIMD_AVX2: {
+				count_ascii = _UTF8_WidenASCIIAVX2(data + it, length - it, codepoints_out + count);
+			} break;
+
+			case MEMORY_SIMD_SSE2: {
+				count_ascii = _UTF8_WidenASCIISSE2(data + it, length - it, codepoints_out + count);
+			} break;
+
+			default: {
+			} break;
+		}
+
+		it    += count_ascii;
+		count += count_ascii;
+
+		while(it < length AND data[it] < 0x80)
+			codepoints_out[count++] = data[it++];
+
+		if (it >= length)
+			break;
+
+		s32 count_bytes = _UTF8_Decode(s_data.value + it, length - it, codepoints_out + count);
+
+		if (count_bytes < 0)
+			break;
+
+		it += count_bytes;
+		++count;
+	}
 
-    codepoint |= ((code >> bit_shift) & bit_mask) << bit_count;
+	if (length_decoded_out)
+		*length_decoded_out = it;
 
-    return codepoint;
+	return count;
 }
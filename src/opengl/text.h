@@ -54,6 +54,15 @@ operator == (
 	return true;
 }
 
+/// consistent with operator ==, different sizes
+/// of the same codepoint share one hash
+instant u64
+Codepoint_GetHash(
+	const Codepoint &codepoint
+) {
+	return Hash_Get(codepoint.codepoint);
+}
+
 
 /// @Important: must call this at the end of each frame,
 ///             in case an event trigger has fired
@@ -141,6 +150,8 @@ Font_Load(
     Font font = {};
     String s_font_data = File_ReadAll(s_file, true);
 
+    Array_EnableIndex(font.a_codepoint, Codepoint_GetHash);
+
     if (String_IsEmpty(s_font_data, true)) {
 		String_Append(font.s_error, S("Font \""));
 		String_Append(font.s_error, s_file);
@@ -180,6 +191,8 @@ Font_Destroy(
         Codepoint_Destroy(t_codepoint);
 	}
 
+	Array_DestroyContainer(font_out->a_codepoint);
+
 	String_Destroy(font_out->s_data);
 	String_Destroy(font_out->s_error);
 
@@ -656,7 +669,7 @@ Text_CalcLineCount(
 
 		index_data += ts_word->length;
 
-		if (String_EndWith(*ts_word, S("\n"), true)) {
+		if (String_EndWith(*ts_word, "\n"_s, true)) {
 			++count_lines;
 			line_start = true;
 
@@ -740,7 +753,7 @@ Text_BuildLines(
 
 			index_data += ts_word->length;
 
-			if (String_EndWith(*ts_word, S("\n"), true)) {
+			if (String_EndWith(*ts_word, "\n"_s, true)) {
 				Array_AddEmpty(*a_text_line_out, &text_line);
 				text_line->s_data.value = &ts_data->value[index_data];
 
@@ -815,7 +828,7 @@ Text_BuildLines(
 
 			index_data += ts_word->length;
 
-			if (String_EndWith(*ts_word, S("\n"), true)) {
+			if (String_EndWith(*ts_word, "\n"_s, true)) {
 				Array_AddEmpty(*a_text_line_out, &text_line);
 				line_start = true;
 
@@ -879,6 +892,39 @@ Text_GetAlignOffsetX(
 	return x_align_offset;
 }
 
+/// decodes a whole line at once (ASCII runs with SIMD), invalid bytes
+/// are kept as a codepoint of their own, like String_GetCodepoint does
+///
+/// returns the amount of codepoints
+instant u64
+_Text_DecodeCodepoints(
+	const String &s_data,
+	Array<u32> &a_codepoints_out
+) {
+	Array_ClearContainer(a_codepoints_out);
+	Array_Reserve(a_codepoints_out, s_data.length);
+
+	String s_data_it = S(s_data);
+
+	while(!String_IsEmpty(s_data_it)) {
+		u64 length_decoded = 0;
+
+		a_codepoints_out.count += UTF8_Decode(s_data_it,
+											  a_codepoints_out.memory + a_codepoints_out.count,
+											  &length_decoded);
+
+		if (length_decoded < s_data_it.length) {
+			ARRAY_IT(a_codepoints_out, a_codepoints_out.count) = (u8)s_data_it.value[length_decoded];
+			++a_codepoints_out.count;
+			++length_decoded;
+		}
+
+		String_AddOffset(s_data_it, length_decoded);
+	}
+
+	return a_codepoints_out.count;
+}
+
 instant void
 Text_ReserveMemory(
 	Font             *font,
@@ -892,16 +938,18 @@ Text_ReserveMemory(
 	Codepoint codepoint_space;
 	Codepoint_GetData(font, ' ', &codepoint_space);
 
+	/// since it is used for every line of every text
+	static Array<u32> a_codepoints;
+
 	FOR_ARRAY(*a_text_lines, it_line) {
 		Text_Line *text_line = &ARRAY_IT(*a_text_lines, it_line);
 
-		String s_data_it = S(text_line->s_data);
+		u64 count_codepoints = _Text_DecodeCodepoints(text_line->s_data, a_codepoints);
 
-		while(!String_IsEmpty(s_data_it)) {
+		FOR(count_codepoints, it_codepoint) {
 			Codepoint codepoint;
-			s32 utf_byte_count = 0;
 
-			s32 cp = String_GetCodepoint(s_data_it, &utf_byte_count);
+			s32 cp = ARRAY_IT(a_codepoints, it_codepoint);
 
  			Codepoint_GetDataConditional(
 				font,
@@ -917,33 +965,31 @@ Text_ReserveMemory(
 				Vertex_Buffer<float> *t_attribute;
 
 				if (!Vertex_FindOrAdd(a_vertex_chars_io, &codepoint.texture, &t_vertex)) {
-					Vertex_FindOrAddAttribute(t_vertex, 2, "vertex_position", &t_attribute);
-					Vertex_FindOrAddAttribute(t_vertex, 3, "text_color", &t_attribute);
-					Vertex_FindOrAddAttribute(t_vertex, 4, "render_area", &t_attribute);
+					Vertex_FindOrAddAttribute(t_vertex, 2, "vertex_position"_s, &t_attribute);
+					Vertex_FindOrAddAttribute(t_vertex, 3, "text_color"_s, &t_attribute);
+					Vertex_FindOrAddAttribute(t_vertex, 4, "render_area"_s, &t_attribute);
 				}
 				{
 					t_attribute = &ARRAY_IT(t_vertex->a_attributes, 0);
-					Assert(S("vertex_position") == t_attribute->name);
+					Assert("vertex_position"_s == t_attribute->name);
 
 					t_attribute->group_count += 2;
 				}
 
 				{
 					t_attribute = &ARRAY_IT(t_vertex->a_attributes, 1);
-					Assert(S("text_color") == t_attribute->name);
+					Assert("text_color"_s == t_attribute->name);
 
 					t_attribute->group_count += 3;
 				}
 
 				{
 					t_attribute = &ARRAY_IT(t_vertex->a_attributes, 2);
-					Assert(S("render_area") == t_attribute->name);
+					Assert("render_area"_s == t_attribute->name);
 
 					t_attribute->group_count += 4;
 				}
 			}
-
-			String_AddOffset(s_data_it, utf_byte_count);
 		}
 	}
 
@@ -984,15 +1030,17 @@ Vertex_AddText(
 	Codepoint codepoint_space;
 	Codepoint_GetData(font, ' ', &codepoint_space);
 
-	String s_data_it = S(s_data);
-
 	u64 x_align_offset = Text_GetAlignOffsetX(font, align_x, s_data, codepoint_space.advance, rect.w);
 
-	while (!String_IsEmpty(s_data_it)) {
+	/// since it is used for every text render
+	static Array<u32> a_codepoints;
+
+	u64 count_codepoints = _Text_DecodeCodepoints(s_data, a_codepoints);
+
+	FOR(count_codepoints, it_codepoint) {
 		Codepoint codepoint;
-		s32 utf_byte_count = 0;
 
-		s32 cp = String_GetCodepoint(s_data_it, &utf_byte_count);
+		s32 cp = ARRAY_IT(a_codepoints, it_codepoint);
 
 		Codepoint_GetDataConditional(
 			font,
@@ -1016,13 +1064,13 @@ Vertex_AddText(
 			Vertex_Buffer<float> *t_attribute;
 
 			if (!Vertex_FindOrAdd(a_vertex_chars_io, &codepoint.texture, &t_vertex)) {
-				Vertex_FindOrAddAttribute(t_vertex, 2, "vertex_position", &t_attribute);
-				Vertex_FindOrAddAttribute(t_vertex, 3, "text_color", &t_attribute);
-				Vertex_FindOrAddAttribute(t_vertex, 4, "render_area", &t_attribute);
+				Vertex_FindOrAddAttribute(t_vertex, 2, "vertex_position"_s, &t_attribute);
+				Vertex_FindOrAddAttribute(t_vertex, 3, "text_color"_s, &t_attribute);
+				Vertex_FindOrAddAttribute(t_vertex, 4, "render_area"_s, &t_attribute);
 			}
 			{
 				t_attribute = &ARRAY_IT(t_vertex->a_attributes, 0);
-				Assert(S("vertex_position") == t_attribute->name);
+				Assert("vertex_position"_s == t_attribute->name);
 
 				Array_ReserveAdd(t_attribute->a_buffer, 2);
 				Array_Add(t_attribute->a_buffer, rect_position.x + x_align_offset);
@@ -1031,7 +1079,7 @@ Vertex_AddText(
 
 			{
 				t_attribute = &ARRAY_IT(t_vertex->a_attributes, 1);
-				Assert(S("text_color") == t_attribute->name);
+				Assert("text_color"_s == t_attribute->name);
 
 				Array_ReserveAdd(t_attribute->a_buffer, 3);
 				Array_Add(t_attribute->a_buffer, color.r);
@@ -1041,7 +1089,7 @@ Vertex_AddText(
 
 			{
 				t_attribute = &ARRAY_IT(t_vertex->a_attributes, 2);
-				Assert(S("render_area") == t_attribute->name);
+				Assert("render_area"_s == t_attribute->name);
 
 				Array_ReserveAdd(t_attribute->a_buffer, 4);
 				Array_Add(t_attribute->a_buffer, (float)rect_crop.x);
@@ -1052,8 +1100,6 @@ Vertex_AddText(
 		}
 
 		rect_position.x += codepoint.advance - codepoint.left_side_bearing;
-
-		String_AddOffset(s_data_it, utf_byte_count);
 	}
 }
 
@@ -1181,6 +1227,8 @@ Text_Update(
 	if (!Text_HasChanged(text_io, false))
 		return false;
 
+	MEMORY_TAG("Text_Update");
+
 	MEASURE_START();
 
 	/// redraw text
@@ -1530,7 +1578,7 @@ Text_Cursor_Move(
 				if (cursor->data.index_select_end < text_io->s_data.length)
 					cursor->data.index_select_end -= 1;
 
-				if (String_EndWith(text_line->s_data, S("\r\n"), true))
+				if (String_EndWith(text_line->s_data, "\r\n"_s, true))
 					cursor->data.index_select_end -= 1;
 
 				if (cursor->data.index_select_end != index_cursor) {
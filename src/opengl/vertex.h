@@ -9,7 +9,10 @@ enum VERTEX_TYPE {
 template <typename T>
 struct Vertex_Buffer {
 	u32 id = 0;
-	const char *name = 0;
+	/// null-terminated, copied when added from a String
+	String name;
+	/// Hash_Get(name), rejects different names without comparing them
+	u64 name_hash = 0;
 	u32 group_count = 0;
 	Array<T> a_buffer;
 };
@@ -49,13 +52,25 @@ operator == (
 	return false;
 }
 
+/// consistent with operator ==, vertices without
+/// texture share one hash and compare the array_id
+instant u64
+Vertex_GetHash(
+	const Vertex &vertex
+) {
+	return Hash_Get(vertex.texture.ID);
+}
+
 template <typename T>
 bool
 operator == (
 	Vertex_Buffer<T> &b1,
 	Vertex_Buffer<T> &b2
 ) {
-	return String_IsEqual(b1.name, b2.name);
+	if (b1.name_hash != b2.name_hash)
+		return false;
+
+	return (b1.name == b2.name);
 }
 
 instant bool
@@ -112,6 +127,7 @@ Vertex_Destroy(
 		Vertex_Buffer<float> *t_attribute = &ARRAY_IT(vertex_out->a_attributes, it);
 		glDeleteBuffers(1, &t_attribute->id);
 		Array_DestroyContainer(t_attribute->a_buffer);
+		String_Destroy(t_attribute->name);
 	}
 
 	glDeleteVertexArrays(1, &vertex_out->array_id);
@@ -216,12 +232,12 @@ Vertex_Load(
 
 	FOR_ARRAY(vertex->a_attributes, it) {
 		Vertex_Buffer<float> *entry = &ARRAY_IT(vertex->a_attributes, it);
-		s32 attrib_position = glGetAttribLocation(shader_prog->id, entry->name);
+		s32 attrib_position = glGetAttribLocation(shader_prog->id, entry->name.value);
 
 		if (attrib_position < 0) {
 			String s_error;
 			String_Append(s_error, S("[Vertex] Shader and attributes mismatch.\n    Missing: \""));
-			String_Append(s_error, S(entry->name));
+			String_Append(s_error, entry->name);
 			String_Append(s_error, S("\"\0", 2));
 
 			AssertMessage(false, s_error.value);
@@ -323,7 +339,7 @@ Vertex_Render(
 	///@Hint: vertex positions have to be the first entry in the array
 	Vertex_Buffer<float> *a_positions = &ARRAY_IT(vertex->a_attributes, 0);
 
-	Assert(String_IsEqual(a_positions->name, "vertex_position"));
+	Assert(a_positions->name == "vertex_position"_s);
 
 	AssertMessage(	vertex->array_id,
 					"[Vertex] Vertex has not been created. Forgot to call Vertex_Create?");
@@ -380,6 +396,9 @@ Vertex_FindOrAdd(
 	Assert(texture_find);
 	Assert(entry_out);
 
+	if (!a_vertex_io->index)
+		Array_EnableIndex(*a_vertex_io, Vertex_GetHash);
+
 	Vertex *t_vertex_entry;
 	Vertex  t_vertex_find;
 	t_vertex_find.texture = *texture_find;
@@ -395,21 +414,71 @@ Vertex_FindOrAdd(
 }
 
 instant bool
-Vertex_FindOrAddAttribute(
+_Vertex_FindOrAddAttribute(
 	Vertex *vertex_io,
 	u32 group_count,
-	const char *c_attribute_name,
+	const String &s_attribute_name,
+	u64 attribute_hash,
+	bool is_null_terminated,
 	Vertex_Buffer<float> **a_buffer_out
 ) {
 	Assert(vertex_io);
-	Assert(c_attribute_name);
 	Assert(a_buffer_out);
 
 	Vertex_Buffer<float> t_attribute_find;
-	t_attribute_find.name = c_attribute_name;
+	t_attribute_find.name = S(s_attribute_name);
+	t_attribute_find.name_hash = attribute_hash;
 	t_attribute_find.group_count = group_count;
 
-	return Array_FindOrAdd(vertex_io->a_attributes, t_attribute_find, a_buffer_out);
+	bool found = Array_FindOrAdd(vertex_io->a_attributes, t_attribute_find, a_buffer_out);
+
+	/// Vertex_Load passes the name to glGetAttribLocation on every render
+	if (!found AND !is_null_terminated) {
+		(*a_buffer_out)->name.value = String_CreateCBufferCopy(s_attribute_name);
+		(*a_buffer_out)->name.is_reference = false;
+	}
+
+	return found;
+}
+
+/// s_attribute_name: hashed on every call and copied, when added,
+///                   literals ("..."_s) come with their hash
+instant bool
+Vertex_FindOrAddAttribute(
+	Vertex *vertex_io,
+	u32 group_count,
+	const String &s_attribute_name,
+	Vertex_Buffer<float> **a_buffer_out
+) {
+	return _Vertex_FindOrAddAttribute(vertex_io, group_count, s_attribute_name,
+									  Hash_Get(s_attribute_name), false, a_buffer_out);
+}
+
+/// c_attribute_name: has to stay valid as long as the vertex
+instant bool
+Vertex_FindOrAddAttribute(
+	Vertex *vertex_io,
+	u32 group_count,
+	const char *c_attribute_name,
+	Vertex_Buffer<float> **a_buffer_out
+) {
+	Assert(c_attribute_name);
+
+	String s_attribute_name = S(c_attribute_name);
+
+	return _Vertex_FindOrAddAttribute(vertex_io, group_count, s_attribute_name,
+									  Hash_Get(s_attribute_name), true, a_buffer_out);
+}
+
+instant bool
+Vertex_FindOrAddAttribute(
+	Vertex *vertex_io,
+	u32 group_count,
+	const StringLiteral &s_attribute_name,
+	Vertex_Buffer<float> **a_buffer_out
+) {
+	return _Vertex_FindOrAddAttribute(vertex_io, group_count, s_attribute_name,
+									  s_attribute_name.hash, true, a_buffer_out);
 }
 
 instant void
@@ -422,7 +491,7 @@ Vertex_AddTexturePosition(
 
 	Vertex_Buffer<float> *t_attribute;
 
-	Vertex_FindOrAddAttribute(vertex_io, 2, "vertex_position", &t_attribute);
+	Vertex_FindOrAddAttribute(vertex_io, 2, "vertex_position"_s, &t_attribute);
 	Array_Reserve(t_attribute->a_buffer, 2);
 	Array_Add(t_attribute->a_buffer, x);
 	Array_Add(t_attribute->a_buffer, y);
@@ -439,14 +508,14 @@ Vertex_AddRect32(
 
 	Vertex_Buffer<float> *t_attribute;
 
-	Vertex_FindOrAddAttribute(vertex_io, 4, "vertex_position", &t_attribute);
+	Vertex_FindOrAddAttribute(vertex_io, 4, "vertex_position"_s, &t_attribute);
 	Array_Reserve(t_attribute->a_buffer, 4);
 	Array_Add(t_attribute->a_buffer, (float)rect.x);
 	Array_Add(t_attribute->a_buffer, (float)rect.y);
 	Array_Add(t_attribute->a_buffer, (float)rect.x + rect.w);
 	Array_Add(t_attribute->a_buffer, (float)rect.y + rect.h);
 
-	Vertex_FindOrAddAttribute(vertex_io, 4, "rect_color", &t_attribute);
+	Vertex_FindOrAddAttribute(vertex_io, 4, "rect_color"_s, &t_attribute);
 	Array_Reserve(t_attribute->a_buffer, 4);
 	Array_Add(t_attribute->a_buffer, (float)color.r);
 	Array_Add(t_attribute->a_buffer, (float)color.g);
@@ -468,14 +537,14 @@ Vertex_AddPoint(
 
 	Vertex_Buffer<float> *t_attribute;
 
-	Vertex_FindOrAddAttribute(vertex_io, 3, "vertex_position", &t_attribute);
+	Vertex_FindOrAddAttribute(vertex_io, 3, "vertex_position"_s, &t_attribute);
 
 	Array_Reserve(t_attribute->a_buffer, 3);
 	Array_Add(t_attribute->a_buffer, point.x);
 	Array_Add(t_attribute->a_buffer, point.y);
 	Array_Add(t_attribute->a_buffer, point.z);
 
-	Vertex_FindOrAddAttribute(vertex_io, 4, "vertex_color", &t_attribute);
+	Vertex_FindOrAddAttribute(vertex_io, 4, "vertex_color"_s, &t_attribute);
 	Array_Reserve(t_attribute->a_buffer, 4);
 	Array_Add(t_attribute->a_buffer, (float)color.r);
 	Array_Add(t_attribute->a_buffer, (float)color.g);
@@ -493,7 +562,7 @@ Vertex_AddRectTexture(
 
 	Vertex_Buffer<float> *t_attribute;
 
-	Vertex_FindOrAddAttribute(vertex_io, 4, "vertex_position", &t_attribute);
+	Vertex_FindOrAddAttribute(vertex_io, 4, "vertex_position"_s, &t_attribute);
 	Array_Reserve(t_attribute->a_buffer, 4);
 	Array_Add(t_attribute->a_buffer, (float)rect.x);
 	Array_Add(t_attribute->a_buffer, (float)rect.y);
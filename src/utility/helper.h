@@ -98,13 +98,8 @@ Array_Sort_Ascending(
 	if(!array_io->count)
 		return;
 
-	/// @Rant: noticably faster than the below lambda version,
-	///        which would be even worst without force-inlining
-	Array_Sort(array_io, SORT_ORDER_ASCENDING);
-
-	///	Array_Sort(array_io, [](T one, T two) __forceinline -> bool {
-	///		return (one < two);
-	///	});
+	/// comparison gets inlined (same as passing a lambda)
+	Array_Sort(*array_io, SORT_ORDER_ASCENDING);
 }
 
 template <typename T>
@@ -117,13 +112,8 @@ Array_Sort_Descending(
 	if(!array_io->count)
 		return;
 
-	/// @Rant: noticably faster than the below lambda version,
-	///        which would be even worst without force-inlining
-	Array_Sort(array_io, SORT_ORDER_DESCENDING);
-
-	///	Array_Sort(array_io, [](T one, T two) __forceinline -> {
-	///		return (one > two);
-	///	});
+	/// comparison gets inlined (same as passing a lambda)
+	Array_Sort(*array_io, SORT_ORDER_DESCENDING);
 }
 
 Font Font_Create(Window &window, const String &s_fontFile, u16 fontSize, bool isRequired) {
@@ -5,6 +5,22 @@ struct Dependency {
 	Array<String> as_depencency;
 };
 
+bool
+operator == (
+	Dependency &dep1,
+	Dependency &dep2
+) {
+	return dep1.s_file == dep2.s_file;
+}
+
+/// consistent with operator ==
+instant u64
+Dependency_GetHash(
+	const Dependency &dependency
+) {
+	return Hash_Get(dependency.s_file);
+}
+
 /// will not include system libraries
 instant void
 Profiler_AnalyseDependencies(
@@ -14,6 +30,9 @@ Profiler_AnalyseDependencies(
 ) {
 	Assert(a_dependencies_io);
 
+	if (!a_dependencies_io->index)
+		Array_EnableIndex(*a_dependencies_io, Dependency_GetHash);
+
 	String s_filepath;
 	String_Overwrite(s_filepath, s_path);
 	String_Append(   s_filepath, s_filename);
@@ -47,11 +66,7 @@ Profiler_AnalyseDependencies(
 			dep_find.s_file = String_Copy(s_path);
 			String_Append(dep_find.s_file, s_token);
 
-			bool entry_existed = Array_FindOrAdd(*a_dependencies_io, dep_find, &dep_entry,
-				[](auto element, auto find) {
-					return (element.s_file == find.s_file);
-				}
-			);
+			bool entry_existed = Array_FindOrAdd(*a_dependencies_io, dep_find, &dep_entry);
 
 			/// would become invalid in case more than one file is being analyzed
 			{
@@ -2,14 +2,15 @@
 
 #pragma once
 
-#define INPUT_KEY_COUNT 0xFFFF
+/// indexed by the translated UTF-16 character
+#define INPUT_KEY_COUNT 0x10000
 
 /// Notes:
 /// no accents support
 
 struct InputState {
-    bool key_repeating[INPUT_KEY_COUNT];
-    bool key_pressing[INPUT_KEY_COUNT];
+    BitSet<INPUT_KEY_COUNT> key_repeating;
+    BitSet<INPUT_KEY_COUNT> key_pressing;
     u8 keys_pressed = 0;
     u8 last_key_repeated = 0;
     u8 last_key_pressed = 0;
@@ -42,8 +43,8 @@ Input_UpdateKeyboard(InputState &state) {
             bool is_pressing  = (vkey & 0x0001);
 
             auto ch = wch[result-1];
-            state.key_pressing[ch]  = is_pressing;
-            state.key_repeating[ch] = is_repeating;
+            BitSet_Set(state.key_pressing , ch, is_pressing);
+            BitSet_Set(state.key_repeating, ch, is_repeating);
             state.keys_pressed += is_repeating;
 
             if (is_pressing) {
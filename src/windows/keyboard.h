@@ -1,15 +1,16 @@
 #pragma once
 
-#define KEYBOARD_KEYCOUNT 0xFFFF
+/// virtual-key codes (msg.wParam) are 1..254
+#define KEYBOARD_KEYCOUNT 256
 
 struct Keyboard {
-    bool up[KEYBOARD_KEYCOUNT] 			= {};
-    bool down[KEYBOARD_KEYCOUNT] 		= {};
-    bool pressing[KEYBOARD_KEYCOUNT] 	= {};
-    bool repeating[KEYBOARD_KEYCOUNT] 	= {};
-    bool toggled[KEYBOARD_KEYCOUNT] 	= {};
+    BitSet<KEYBOARD_KEYCOUNT> up;
+    BitSet<KEYBOARD_KEYCOUNT> down;
+    BitSet<KEYBOARD_KEYCOUNT> pressing;
+    BitSet<KEYBOARD_KEYCOUNT> repeating;
+    BitSet<KEYBOARD_KEYCOUNT> toggled;
 
-    /// last_key_virtual = msg.wParam = SL_KEYBOARD_KEYCOUNT (max.)
+    /// last_key_virtual = msg.wParam < KEYBOARD_KEYCOUNT
 	u32  last_key_virtual	= 0;
 	u16  key_sym			= 0;		/// translated key (incl. shift + alt)
 	u32  key_scan			= 0;		/// scancode
@@ -31,21 +32,17 @@ Keyboard_Reset(
 	if (!keyboard_out)
 		return;
 
-	bool pressing[KEYBOARD_KEYCOUNT] = {};
-	bool toggled[KEYBOARD_KEYCOUNT]  = {};
-
 	bool is_enabled = keyboard_out->enable_return_post_startup;
 
-	if (!full_reset) {
-		Memory_Copy(&pressing, &keyboard_out->pressing, sizeof(bool) * KEYBOARD_KEYCOUNT);
-		Memory_Copy(&toggled , &keyboard_out->toggled , sizeof(bool) * KEYBOARD_KEYCOUNT);
-	}
+	/// only pressing and toggled survive a frame (a few cache lines)
+	BitSet<KEYBOARD_KEYCOUNT> pressing = keyboard_out->pressing;
+	BitSet<KEYBOARD_KEYCOUNT> toggled  = keyboard_out->toggled;
 
     *keyboard_out = {};
 
     if (!full_reset) {
-		Memory_Copy(&keyboard_out->pressing, &pressing, sizeof(bool) * KEYBOARD_KEYCOUNT);
-		Memory_Copy(&keyboard_out->toggled , &toggled , sizeof(bool) * KEYBOARD_KEYCOUNT);
+		keyboard_out->pressing = pressing;
+		keyboard_out->toggled  = toggled;
     }
 
     keyboard_out->enable_return_post_startup = is_enabled;
@@ -59,8 +56,10 @@ Keyboard_ResetKey(
 	if (!keyboard_out)
 		return;
 
-	keyboard_out->down[key_virtual] = false;
-	keyboard_out->up[key_virtual] 	= false;
+	if (key_virtual < KEYBOARD_KEYCOUNT) {
+		BitSet_Set(keyboard_out->down, key_virtual, false);
+		BitSet_Set(keyboard_out->up  , key_virtual, false);
+	}
 
 	keyboard_out->is_down 			= false;
 	keyboard_out->is_up 			= false;
@@ -126,12 +125,15 @@ Keyboard_SetDown(
 	Assert(keyboard_io);
 	Assert(msg);
 
+	if (msg->wParam >= KEYBOARD_KEYCOUNT)
+		return;
+
 	keyboard_io->key_scan = MapVirtualKey(msg->wParam, 0);
 
-	keyboard_io->down[msg->wParam] 		= true;
-	keyboard_io->up[msg->wParam] 		= false;
-	keyboard_io->pressing[msg->wParam] 	= true;
-	keyboard_io->repeating[msg->wParam] = GETBIT(msg->lParam, 30);
+	BitSet_Set(keyboard_io->down     , msg->wParam, true);
+	BitSet_Set(keyboard_io->up       , msg->wParam, false);
+	BitSet_Set(keyboard_io->pressing , msg->wParam, true);
+	BitSet_Set(keyboard_io->repeating, msg->wParam, GETBIT(msg->lParam, 30));
 
 	Keyboard_GetKeySym(keyboard_io, msg);
 
@@ -148,6 +150,9 @@ Keyboard_SetUp(
 	Assert(keyboard_io);
 	Assert(msg);
 
+	if (msg->wParam >= KEYBOARD_KEYCOUNT)
+		return;
+
 	if (keyboard_io->enable_return_post_startup) {
 		if (keyboard_io->pressing[VK_RETURN]) {
 			if (msg->wParam == VK_RETURN)
@@ -164,11 +169,11 @@ Keyboard_SetUp(
 		keyboard_io->key_scan = MapVirtualKey(msg->wParam, 0);
 		keyboard_io->last_key_virtual 		= msg->wParam;
 
-		keyboard_io->down[msg->wParam] 		= false;
-		keyboard_io->up[msg->wParam] 		= true;
-		keyboard_io->pressing[msg->wParam] 	= false;
-		keyboard_io->repeating[msg->wParam] = false;
-		keyboard_io->toggled[msg->wParam]   = !keyboard_io->toggled[msg->wParam];
+		BitSet_Set(keyboard_io->down     , msg->wParam, false);
+		BitSet_Set(keyboard_io->up       , msg->wParam, true);
+		BitSet_Set(keyboard_io->pressing , msg->wParam, false);
+		BitSet_Set(keyboard_io->repeating, msg->wParam, false);
+		BitSet_Toggle(keyboard_io->toggled, msg->wParam);
 
 		Keyboard_GetKeySym(keyboard_io, msg);
 
@@ -223,16 +228,7 @@ Keyboard_IsPressingAnyKey(
 ) {
 	Assert(keyboard);
 
-	bool result = false;
-
-	FOR(KEYBOARD_KEYCOUNT, it) {
-		if (keyboard->pressing[it]) {
-			result = true;
-			break;
-		}
-	}
-
-	return result;
+	return BitSet_IsAny(keyboard->pressing);
 }
 
 instant void
@@ -564,6 +564,8 @@ Window_ReadMessage(
 
 	Keyboard_Reset(window.keyboard, false);
 
+	Context_OnFrame();
+
 	/// vsync does not seem to work, when this does not execute,
 	/// so the cpu ends up doing alot more work, because of the
 	/// increased speed in the loop cicle, if this would be disabled
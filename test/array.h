@@ -86,6 +86,35 @@ Test_Arrays(
 		Array_Destroy(&as_data);
 	}
 
+	{
+		Array<u64> a_data;
+
+		FOR(100, it) {
+			Array_Add(a_data, it);
+		}
+
+		AssertMessage(		a_data.count == 100
+						AND a_data.max   == 128, "[Test] Geometric array growth failed.");
+
+		Array_ShrinkToFit(a_data);
+		AssertMessage(a_data.max == a_data.count, "[Test] Array shrinking failed.");
+
+		Array_ReserveAdd(a_data, 2);
+		AssertMessage(a_data.max == 200, "[Test] Array_ReserveAdd ignored the capacity policy.");
+
+		Array<u64> a_chunk;
+		Array_SetCapacityPolicy(a_chunk, ARRAY_CAPACITY_CHUNK, ARRAY_CAPACITY_FACTOR_DEFAULT, 16);
+
+		FOR(17, it) {
+			Array_Add(a_chunk, it);
+		}
+
+		AssertMessage(a_chunk.max == 32, "[Test] Chunked array growth failed.");
+
+		Array_DestroyContainer(a_data);
+		Array_DestroyContainer(a_chunk);
+	}
+
 	{
 		String s_split;
 		String_Append(&s_split, S("aaa\nbbb"));
@@ -538,6 +567,100 @@ Test_Arrays(
 		Array_DestroyContainer(&a_numbers);
 	}
 
+	{
+		Array<u64> a_numbers;
+
+		FOR(10, it) {
+			Array_Add(a_numbers, it);
+		}
+
+		/// 0 1 2 3 4 5 6 7 8 9 -> 1 3 5 7 9
+		u64 count_removed = Array_RemoveIf(a_numbers, [](u64 value) {
+			return (value % 2 == 0);
+		});
+
+		AssertMessage(		count_removed == 5
+						AND a_numbers.count == 5
+						AND ARRAY_IT(a_numbers, 0) == 1
+						AND ARRAY_IT(a_numbers, 4) == 9, "[Test] Array_RemoveIf failed.");
+
+		/// 1 3 5 7 9 -> 1 9 5 7
+		Array_RemoveSwap(a_numbers, 1);
+
+		AssertMessage(		a_numbers.count == 4
+						AND ARRAY_IT(a_numbers, 1) == 9, "[Test] Array_RemoveSwap failed.");
+
+		/// 1 9 5 7 -> 1 7
+		Array_RemoveRange(a_numbers, 1, 2);
+
+		AssertMessage(		a_numbers.count == 2
+						AND ARRAY_IT(a_numbers, 0) == 1
+						AND ARRAY_IT(a_numbers, 1) == 7, "[Test] Array_RemoveRange failed.");
+
+		/// predicate takes a non-const reference
+		/// 1 7 -> 7
+		Array_Filter(a_numbers, [](u64 &value) {
+			return (value > 1);
+		});
+
+		AssertMessage(		a_numbers.count == 1
+						AND ARRAY_IT(a_numbers, 0) == 7, "[Test] Array_Filter with reference predicate failed.");
+
+		Array_DestroyContainer(a_numbers);
+	}
+
+	{
+		Array<u64> a_numbers;
+		Array_EnableIndex(a_numbers);
+
+		FOR(100, it) {
+			Array_AddUnique(a_numbers, it % 50);
+		}
+
+		AssertMessage(a_numbers.count == 50, "[Test] Array_AddUnique with index added duplicates.");
+
+		/// 0 .. 49 -> 0 49 2 .. 48
+		Array_RemoveSwap(a_numbers, 1);
+
+		u64 index = 0;
+		AssertMessage(		!Array_Find(a_numbers, (u64)1)
+						AND  Array_Find(a_numbers, (u64)49, &index)
+						AND  index == 1, "[Test] Array index not updated after Array_RemoveSwap.");
+
+		Array_Remove(a_numbers, 0);
+
+		AssertMessage(		 Array_Find(a_numbers, (u64)49, &index)
+						AND  index == 0
+						AND !Array_Find(a_numbers, (u64)0), "[Test] Array index not updated after Array_Remove.");
+
+		/// 49 2 3 4 5 6 .. 48 -> 49 5 6 .. 48
+		Array_RemoveRange(a_numbers, 1, 3);
+
+		AssertMessage(		 Array_Find(a_numbers, (u64)6, &index)
+						AND  index == 2
+						AND !Array_Find(a_numbers, (u64)3)
+						AND !a_numbers.index->is_outdated, "[Test] Array index not updated after Array_RemoveRange.");
+
+		/// same count as before, but other values
+		Array_ClearContainer(a_numbers);
+
+		FOR(45, it) {
+			Array_Add(a_numbers, it + 100);
+		}
+
+		AssertMessage(		 Array_Find(a_numbers, (u64)103, &index)
+						AND  index == 3
+						AND !Array_Find(a_numbers, (u64)49), "[Test] Array index not rebuild after Array_ClearContainer.");
+
+		/// predicate does not match the hash of operator ==
+		AssertMessage(		 Array_Find(a_numbers, (u64)3, &index, [](u64 element, u64 find) {
+								return (element % 100 == find);
+							})
+						AND  index == 3, "[Test] Array_Find with OnSearch used the index.");
+
+		Array_DestroyContainer(a_numbers);
+	}
+
 	{
 		u64 max = 10000;
 
@@ -557,6 +680,188 @@ Test_Arrays(
 		Array_FillTest(&a_test, SORT_ORDER_ASCENDING);
 	}
 
+	{
+		/// organ pipe with duplicates, which degraded
+		/// the middle pivot quicksort to O(n^2)
+		u64 max = 100000;
+
+		Array<u64> a_test;
+
+		FOR(max, it) {
+			Array_Add(a_test, ((it < max / 2) ? it : max - it) / 4);
+		}
+
+		Array_Sort(&a_test, SORT_ORDER_ASCENDING);
+
+		bool is_sorted = true;
+
+		FOR_ARRAY_START(a_test, it, 1) {
+			is_sorted = is_sorted AND (ARRAY_IT(a_test, it - 1) <= ARRAY_IT(a_test, it));
+		}
+
+		AssertMessage(is_sorted, "[Test] Array_Sort (organ pipe) failed.");
+
+		Array_DestroyContainer(a_test);
+	}
+
+	{
+		/// equal keys have to keep their insertion order
+		struct test {
+			u32 key;
+			u32 order;
+		};
+
+		Array<test> a_test;
+
+		FOR(1000, it) {
+			Array_Add(a_test, {(u32)((it * 7919) % 13), (u32)it});
+		}
+
+		Array_SortStable(a_test, [](const test &one, const test &two) { return (one.key < two.key); });
+
+		bool is_stable = true;
+
+		FOR_ARRAY_START(a_test, it, 1) {
+			test &prev = ARRAY_IT(a_test, it - 1);
+			test &curr = ARRAY_IT(a_test, it);
+
+			is_stable = is_stable AND (   prev.key < curr.key
+									   OR (prev.key == curr.key AND prev.order < curr.order));
+		}
+
+		AssertMessage(is_stable, "[Test] Array_SortStable failed.");
+
+		Array_DestroyContainer(a_test);
+	}
+
+	{
+		/// odd thread count, so one partition has no merge partner
+		u64 max = 200000;
+
+		Array<u64> a_test;
+
+		FOR(max, it) {
+			Array_Add(a_test, (it * 2654435761ull) % 100003);
+		}
+
+		Array_SortParallel(a_test, SORT_ORDER_ASCENDING, 3);
+
+		bool is_sorted = (a_test.count == max);
+
+		FOR_ARRAY_START(a_test, it, 1) {
+			is_sorted = is_sorted AND (ARRAY_IT(a_test, it - 1) <= ARRAY_IT(a_test, it));
+		}
+
+		AssertMessage(is_sorted, "[Test] Array_SortParallel failed.");
+
+		Array_DestroyContainer(a_test);
+	}
+
+	{
+		Array<u64> a_test;
+		Array<u64> a_top;
+
+		FOR(1000, it) {
+			Array_Add(a_test, (it * 7919) % 1000);
+		}
+
+		Array_TopK(a_test, 3, a_top, [](u64 one, u64 two) { return (one > two); });
+
+		AssertMessage(		a_top.count == 3
+						AND ARRAY_IT(a_top, 0) == 999
+						AND ARRAY_IT(a_top, 2) == 997, "[Test] Array_TopK failed.");
+
+		Array_SelectNth(a_test, 500, SORT_ORDER_ASCENDING);
+
+		AssertMessage(ARRAY_IT(a_test, 500) == 500, "[Test] Array_SelectNth failed.");
+
+		Array_PartialSort(a_test, 10, SORT_ORDER_ASCENDING);
+
+		AssertMessage(		ARRAY_IT(a_test, 0) == 0
+						AND ARRAY_IT(a_test, 9) == 9, "[Test] Array_PartialSort failed.");
+
+		Array_DestroyContainer(a_test);
+		Array_DestroyContainer(a_top);
+	}
+
+	{
+		Array<u32> a_test;
+		Array<u32> a_other;
+		Array<u32> a_result;
+
+		FOR(10, it) {
+			Array_InsertSorted(a_test, (u32)((it * 7) % 10));
+		}
+
+		Array_Add(a_other, 3u);
+		Array_Add(a_other, 5u);
+		Array_Add(a_other, 42u);
+
+		AssertMessage(		Array_IsSorted(a_test)
+						AND Array_LowerBound(a_test, 5u) == 5
+						AND Array_UpperBound(a_test, 5u) == 6
+						AND Array_LowerBound(a_test, 42u) == 10, "[Test] Array_LowerBound / UpperBound failed.");
+
+		Array_SetIntersection(a_test, a_other, a_result);
+
+		AssertMessage(		a_result.count == 2
+						AND ARRAY_IT(a_result, 1) == 5, "[Test] Array_SetIntersection failed.");
+
+		Array_SetDifference(a_test, a_other, a_result);
+
+		AssertMessage(a_result.count == 8, "[Test] Array_SetDifference failed.");
+
+		Array_ToEytzinger(a_test, a_result);
+
+		u64 index;
+
+		AssertMessage(		 Array_EytzingerFind(a_result, 7u, &index)
+						AND  ARRAY_IT(a_result, index) == 7
+						AND !Array_EytzingerFind(a_result, 42u), "[Test] Array_EytzingerFind failed.");
+
+		Array_DestroyContainer(a_test);
+		Array_DestroyContainer(a_other);
+		Array_DestroyContainer(a_result);
+	}
+
+	{
+		SmallArray<u32, 2> a_test;
+
+		Array_Add(a_test, 1u);
+		Array_Add(a_test, 2u);
+
+		bool is_inline = SmallArray_IsInline(a_test);
+
+		Array_Add(a_test, 3u);
+		Array_Remove(a_test, 0);
+
+		AssertMessage(		 is_inline
+						AND !SmallArray_IsInline(a_test)
+						AND  a_test.count == 2
+						AND  ARRAY_IT(a_test, 0) == 2
+						AND  Array_Find(a_test, 3u), "[Test] SmallArray failed to move to the heap.");
+
+		Array_DestroyContainer(a_test);
+	}
+
+	{
+		Array<float> a_test;
+		Array_Add(a_test,  2.5f);
+		Array_Add(a_test, -1.0f);
+		Array_Add(a_test,  0.0f);
+		Array_Add(a_test, -7.25f);
+		Array_Add(a_test,  100.0f);
+
+		Array_SortRadix(a_test, SORT_RADIX_11);
+
+		AssertMessage(		ARRAY_IT(a_test, 0) == -7.25f
+						AND ARRAY_IT(a_test, 1) == -1.0f
+						AND ARRAY_IT(a_test, 2) ==  0.0f
+						AND ARRAY_IT(a_test, 4) ==  100.0f, "[Test] Array_SortRadix (float) failed.");
+
+		Array_DestroyContainer(a_test);
+	}
+
 	{
 		struct test {
 			int  a = 0;
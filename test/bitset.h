@@ -0,0 +1,37 @@
+#pragma once
+
+instant void
+Test_BitSet(
+) {
+	{
+		BitSet<300> bitset;
+
+		u64 index = 0;
+		AssertMessage(BitSet_IsNone(bitset), "[Test] BitSet is not empty after init");
+		AssertMessage(!BitSet_FindFirst(bitset, &index), "[Test] BitSet found bit in empty set");
+
+		BitSet_Set(bitset, 0);
+		BitSet_Set(bitset, 63);
+		BitSet_Set(bitset, 64);
+		BitSet_Set(bitset, 299);
+		BitSet_Toggle(bitset, 64);
+		BitSet_Toggle(bitset, 200);
+
+		AssertMessage(bitset[0] AND bitset[63] AND !bitset[64] AND bitset[200], "[Test] BitSet set or toggle failed");
+		AssertMessage(BitSet_Get(bitset, 299) AND !BitSet_Get(bitset, 1), "[Test] BitSet get failed");
+		AssertMessage(BitSet_Count(bitset) == 4, "[Test] BitSet count does not match");
+
+		AssertMessage(BitSet_FindFirst(bitset, &index) AND index == 0, "[Test] BitSet did not find first bit");
+		AssertMessage(BitSet_FindFirst(bitset, &index, 1) AND index == 63, "[Test] BitSet did not find bit in same word");
+		AssertMessage(BitSet_FindFirst(bitset, &index, 64) AND index == 200, "[Test] BitSet did not find bit in later word");
+		AssertMessage(BitSet_FindFirst(bitset, &index, 201) AND index == 299, "[Test] BitSet did not find bit in next block");
+
+		BitSet_Set(bitset, 0, false);
+		BitSet_Set(bitset, 63, false);
+		BitSet_Set(bitset, 200, false);
+		AssertMessage(BitSet_IsAny(bitset), "[Test] BitSet misses bit in last block");
+
+		BitSet_ClearAll(bitset);
+		AssertMessage(BitSet_IsNone(bitset) AND BitSet_Count(bitset) == 0, "[Test] BitSet is not empty after clear");
+	}
+}
@@ -0,0 +1,32 @@
+/// Runs Test_BitSet without the Win32 parts of SLib.h,
+/// once for every memory_simd implementation.
+///
+/// g++ -std=c++20 -O2 -Wall test/bitset_headless.cpp -o bitset_headless
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/core/bitset.h"
+
+#define AssertMessage(EX, INFO) \
+	(void)((EX) OR (fprintf(stderr, "%s [Line: %d]\n", INFO, __LINE__), exit(1), 0))
+
+#include "bitset.h"
+
+int
+main(
+) {
+	Test_BitSet();
+
+	memory_simd = MEMORY_SIMD_SSE2;
+	Test_BitSet();
+
+	if (__builtin_cpu_supports("avx2")) {
+		memory_simd = MEMORY_SIMD_AVX2;
+		Test_BitSet();
+	}
+
+	printf("BitSet: ok\n");
+
+	return 0;
+}
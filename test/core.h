@@ -6,6 +6,9 @@
 #include "array.h"
 #include "files.h"
 #include "parser.h"
+#include "hash_map.h"
+#include "queue.h"
+#include "bitset.h"
 
 instant void
 Test_Run(
@@ -14,6 +17,9 @@ Test_Run(
 	Test_Arrays();
 	Test_Files();
 	Test_Parser();
+	Test_HashMap();
+	Test_Queue();
+	Test_BitSet();
 
 	LOG_DEBUG("tests completed");
 }
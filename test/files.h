@@ -29,6 +29,14 @@ Test_Files(
         String_Destroy(&s_extension);
     }
 
+    {
+        /// more extensions than stored inline
+        String s_file = S("C:/test.ogg");
+
+        AssertMessage(		File_HasExtension(&s_file, S(".a|.b|.c|.d|.e|.f|.g|.h|.ogg"))
+                        AND !File_HasExtension(&s_file, S(".a|.b|.c|.d|.e|.f|.g|.h|.og")), "[Test] File extension finding failed (3).");
+    }
+
     {
 		s64 pos_found;
 		String s_pathfile;
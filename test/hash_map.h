@@ -0,0 +1,64 @@
+#pragma once
+
+instant void
+Test_HashMap(
+) {
+	{
+		HashMap<String, s32> map;
+
+		AssertMessage(!HashMap_Find(map, S("missing")), "[Test] Empty hashmap finds key");
+
+		HashMap_Set(map, S("one"), 1);
+		HashMap_Set(map, S("two"), 2);
+		HashMap_Set(map, S("one"), 11);
+
+		s32 value = 0;
+		AssertMessage(map.count == 2, "[Test] HashMap count does not match after overwrite");
+		AssertMessage(HashMap_Get(map, S("one"), &value) AND value == 11, "[Test] HashMap value was not overwritten");
+		AssertMessage(HashMap_Get(map, S("two"), &value) AND value == 2, "[Test] HashMap value does not match");
+		AssertMessage(!HashMap_Find(map, S("One")), "[Test] HashMap string key is not case-sensitive");
+
+		AssertMessage( HashMap_Remove(map, S("one")), "[Test] HashMap could not remove key");
+		AssertMessage(!HashMap_Remove(map, S("one")), "[Test] HashMap removed key twice");
+		AssertMessage(!HashMap_Find(map, S("one")) AND map.count == 1, "[Test] HashMap still contains removed key");
+
+		HashMap_Destroy(map);
+	}
+
+	{
+		HashMap<u64, u64> map;
+		HashMap_Reserve(map, 1000);
+
+		u64 capacity = map.capacity;
+
+		FOR(1000, it) {
+			HashMap_Set(map, it, it * 3);
+		}
+
+		AssertMessage(map.capacity == capacity, "[Test] HashMap did grow after reserving");
+
+		for(u64 it = 0; it < 1000; it += 2) {
+			HashMap_Remove(map, it);
+		}
+
+		u64 count = 0;
+		bool is_valid = true;
+
+		FOR_HASHMAP(map, it) {
+			HashMap_Entry<u64, u64> *t_entry = &HASHMAP_IT(map, it);
+			is_valid = is_valid AND (t_entry->key & 1) AND t_entry->value == t_entry->key * 3;
+			++count;
+		}
+
+		AssertMessage(is_valid AND count == 500 AND map.count == 500, "[Test] HashMap iteration after removing does not match");
+
+		FOR(1000, it) {
+			u64 *t_value = HashMap_Find(map, it);
+			is_valid = is_valid AND ((it & 1) ? (t_value AND *t_value == it * 3) : !t_value);
+		}
+
+		AssertMessage(is_valid, "[Test] HashMap lookup after backward shift does not match");
+
+		HashMap_Destroy(map);
+	}
+}
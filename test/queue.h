@@ -0,0 +1,79 @@
+#pragma once
+
+instant ulong WINAPI
+_Test_QueueProducer(
+	void *data
+) {
+	Queue_MPMC<u64> &queue = *(Queue_MPMC<u64> *)data;
+
+	FOR_START(1, 10001, it) {
+		while(!Queue_Push(queue, it))
+			Sleep(0);
+	}
+
+	return 0;
+}
+
+instant void
+Test_Queue(
+) {
+	{
+		Queue_SPSC<u32> queue;
+		Queue_Create(queue, 5);
+
+		u32 values[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+		u32 values_out[9] = {};
+
+		AssertMessage(queue.capacity == 8, "[Test] Queue capacity is not a power of 2");
+		AssertMessage(Queue_PushBatch(queue, values, 9) == 8, "[Test] Queue accepted more than its capacity");
+		AssertMessage(!Queue_Push(queue, 10u), "[Test] Queue accepted push while full");
+
+		AssertMessage(Queue_PopBatch(queue, values_out, 3) == 3 AND values_out[2] == 3, "[Test] Queue batch pop failed");
+		AssertMessage(Queue_PushBatch(queue, values, 3) == 3, "[Test] Queue did not reuse popped slots");
+		AssertMessage(Queue_PopBatch(queue, values_out, 9) == 8, "[Test] Queue popped more than it contains");
+		AssertMessage(values_out[4] == 8 AND values_out[7] == 3, "[Test] Queue lost the order after wrap around");
+
+		u32 value;
+		AssertMessage(!Queue_Pop(queue, &value), "[Test] Queue popped while empty");
+
+		Queue_Destroy(queue);
+	}
+
+	{
+		/// 2 producer threads, the sum shows every element arrived once
+		Queue_MPMC<u64> queue;
+		Queue_Create(queue, 64);
+
+		Thread thread_1 = Thread_Create(&queue, _Test_QueueProducer);
+		Thread thread_2 = Thread_Create(&queue, _Test_QueueProducer);
+		Thread_Execute(&thread_1);
+		Thread_Execute(&thread_2);
+
+		u64 sum   = 0;
+		u64 count = 0;
+		u64 values_out[16];
+
+		while(count < 20000) {
+			u64 count_popped = Queue_PopBatch(queue, values_out, 16);
+
+			if (!count_popped)
+				Sleep(0);
+
+			FOR(count_popped, it) {
+				sum += values_out[it];
+			}
+
+			count += count_popped;
+		}
+
+		Thread_WaitFor(&thread_1);
+		Thread_WaitFor(&thread_2);
+		Thread_Destroy(&thread_1);
+		Thread_Destroy(&thread_2);
+
+		AssertMessage(sum == 2 * (10000 * 10001 / 2), "[Test] Queue MPMC lost or duplicated elements");
+		AssertMessage(Queue_Count(queue) == 0, "[Test] Queue MPMC is not empty");
+
+		Queue_Destroy(queue);
+	}
+}
@@ -1,5 +1,20 @@
 #pragma once
 
+instant ulong WINAPI
+_Test_StringWorker(
+	void *data
+) {
+	String s_data;
+
+	FOR(8, it) {
+		String_Append(s_data, S("key"));
+	}
+
+	String_Destroy(s_data);
+
+	return 0;
+}
+
 instant void
 Test_Strings(
 ) {
@@ -194,4 +209,153 @@ Test_Strings(
 					"[Test] UTF8 Insert String failed (2).");
 
     }
+
+	/// substring search (short keys via SIMD filter, long keys via Two-Way)
+	{
+		String s_text = S("Content-Type: text/html\r\ncontent-length: 42\r\n\r\n");
+
+		AssertMessage(String_IndexOf(s_text, S("\r\n\r\n"), 0, true) == 43, "[Test] String search failed.");
+		AssertMessage(String_IndexOf(s_text, S("Content-Length"), 0, true) == -1, "[Test] String search ignored case.");
+		AssertMessage(String_IndexOf(s_text, S("Content-Length"), 0, false) == 25, "[Test] String search without case failed.");
+		AssertMessage(String_IndexOf(s_text, S("text"), 15, true) == -1, "[Test] String search ignored start index.");
+
+		/// key longer than the rest of the data must not match
+		String s_part = S(s_text.value, 10);
+		AssertMessage(String_IndexOf(s_part, S("Content-Type"), 0, true) == -1, "[Test] String search matched beyond length.");
+
+		String s_periodic = S("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab");
+		AssertMessage(String_IndexOf(s_periodic, S("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab"), 0, true) == 18, "[Test] String search with long key failed.");
+		AssertMessage(String_IndexOf(s_periodic, S("AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAB"), 0, false) == 18, "[Test] String search with long key without case failed.");
+	}
+
+	/// multiple keys in one pass
+	{
+		Array<String> as_keys;
+		Array_Add(as_keys, S("error"));
+		Array_Add(as_keys, S("warn"));
+		Array_Add(as_keys, S("warning"));
+
+		String s_log = S("[Warning] disk almost full, error in 3s");
+
+		StringMatcher matcher;
+		StringMatcher_Create(matcher, as_keys, false);
+
+		StringMatcher_Match match;
+		AssertMessage(StringMatcher_FindFirst(matcher, s_log, &match), "[Test] StringMatcher did not find any key.");
+		AssertMessage(match.index == 1 AND match.pattern == 1, "[Test] StringMatcher did not find the leftmost key.");
+		AssertMessage(StringMatcher_FindFirst(matcher, s_log, &match, 2) AND match.pattern == 0, "[Test] StringMatcher ignored start index.");
+
+		Array<StringMatcher_Match> a_matches;
+		AssertMessage(StringMatcher_FindAll(matcher, s_log, a_matches) == 3, "[Test] StringMatcher did not find every key.");
+
+		Array_DestroyContainer(a_matches);
+		StringMatcher_Destroy(matcher);
+
+		/// few delimiters are searched one by one,
+		/// with the same result as the matcher
+		s64 index_delimiter = -1;
+		s64 index_found     = -1;
+
+		AssertMessage(		Array_FindFirstString(&s_log, &as_keys, &index_delimiter, &index_found)
+						AND index_delimiter == 0
+						AND index_found == 28, "[Test] Array_FindFirstString failed.");
+
+		StringMatcher_Create(matcher, as_keys);
+
+		AssertMessage(		Array_FindFirstString(&s_log, matcher, &index_delimiter, &index_found)
+						AND index_delimiter == 0
+						AND index_found == 28, "[Test] Array_FindFirstString with matcher failed.");
+
+		AssertMessage(	   !Array_FindFirstString(&s_log, matcher, &index_delimiter, &index_found, 29)
+						AND index_delimiter == -1
+						AND index_found == (s64)s_log.length, "[Test] Array_FindFirstString ignored start index.");
+
+		StringMatcher_Destroy(matcher);
+		Array_DestroyContainer(as_keys);
+	}
+
+	/// UTF-8 validation and decoding
+	{
+		String s_text = S("Gr\xC3\xBC\xC3\x9F \xE6\x97\xA5\xE6\x9C\xAC \xF0\x9F\x98\x80");
+
+		AssertMessage(String_GetLength(s_text.value, STRING_LENGTH_CODEPOINTS) == 9, "[Test] UTF8 codepoint length failed.");
+		AssertMessage(UTF8_GetCodepointCount(s_text) == 9, "[Test] UTF8 codepoint count failed.");
+		AssertMessage(UTF8_IsValid(s_text), "[Test] UTF8 valid text was rejected.");
+
+		u32 codepoints[32];
+		u64 length_decoded = 0;
+		AssertMessage(UTF8_Decode(s_text, codepoints, &length_decoded) == 9 AND length_decoded == s_text.length, "[Test] UTF8 decoding failed.");
+		AssertMessage(codepoints[2] == 0xFC AND codepoints[5] == 0x65E5 AND codepoints[8] == 0x1F600, "[Test] UTF8 decoded wrong codepoint.");
+
+		u64 index_invalid = 0;
+		AssertMessage(!UTF8_IsValid(S("abc\xC0\xAF", 5), &index_invalid) AND index_invalid == 3, "[Test] UTF8 overlong encoding was accepted.");
+		AssertMessage(!UTF8_IsValid(S("\xED\xA0\x80", 3)), "[Test] UTF8 surrogate was accepted.");
+		AssertMessage(!UTF8_IsValid(S("\xE6\x97", 2)), "[Test] UTF8 cut off sequence was accepted.");
+	}
+
+	/// compile-time literals
+	{
+		constexpr StringLiteral s_literal = "vertex_position"_s;
+		static_assert(s_literal.length == 15 AND s_literal.hash == Hash_Bytes("vertex_position", 15));
+
+		String s_name;
+		String_Append(s_name, S("vertex_position"));
+
+		AssertMessage(s_literal == s_name, "[Test] String literal does not match the string.");
+		AssertMessage(Hash_Get(s_literal) == Hash_Get(s_name), "[Test] String literal hash does not match.");
+		AssertMessage(s_literal != "vertex_color"_s AND "\0"_s.length == 1, "[Test] String literal comparison failed.");
+
+		String_Destroy(s_name);
+	}
+
+#if STRING_BUFFER_DEFAULT_SIZE
+	/// short strings in pool slots
+	{
+		Memory_Header header;
+
+		String s_data;
+		String_Append(s_data, S("config"));
+		char *value_pooled = s_data.value;
+
+		Memory_GetHeader(&header, s_data.value);
+		AssertMessage(header.sig == MEMORY_SIGNATURE_POOL, "[Test] Short string was not pooled.");
+
+		String_Append(s_data, S("_key"));
+		AssertMessage(s_data.value == value_pooled, "[Test] Short string left its pool slot.");
+
+		String_Append(s_data, S(" with a value, which does not fit"));
+
+		Memory_GetHeader(&header, s_data.value);
+		AssertMessage(header.sig == MEMORY_SIGNATURE, "[Test] Long string was not moved to the heap.");
+		AssertMessage(s_data == S("config_key with a value, which does not fit"), "[Test] String content changed while moving to the heap.");
+
+		String s_copy = String_Copy(S("file.txt"));
+		AssertMessage(s_copy == S("file.txt"), "[Test] Short string copy failed.");
+
+		String_Destroy(s_copy);
+		String_Destroy(s_data);
+	}
+
+	/// threads give their cached slots back on exit
+	{
+		/// a first thread may need a new slab legitimately
+		Thread thread = Thread_Create(nullptr, _Test_StringWorker);
+		Thread_Execute(&thread);
+		Thread_WaitFor(&thread);
+		Thread_Destroy(&thread);
+
+		u64  count_slabs = string_pool.data.count_slabs;
+		long count_used  = string_pool.data.count_used;
+
+		FOR(100, it) {
+			thread = Thread_Create(nullptr, _Test_StringWorker);
+			Thread_Execute(&thread);
+			Thread_WaitFor(&thread);
+			Thread_Destroy(&thread);
+		}
+
+		AssertMessage(		string_pool.data.count_slabs == count_slabs
+						AND string_pool.data.count_used  == count_used, "[Test] Exited threads kept string pool slots.");
+	}
+#endif
 }